@@ -0,0 +1,143 @@
+//
+//  RocksDBBenchmark.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The result of timing a benchmarked operation.
+ */
+@interface RocksDBBenchmarkMeasurement : NSObject
+
+/** @brief The name of the measured operation. */
+@property (nonatomic, readonly) NSString *name;
+
+/** @brief The number of operations executed. */
+@property (nonatomic, readonly) NSUInteger operations;
+
+/** @brief The total wall-clock time in nanoseconds. */
+@property (nonatomic, readonly) uint64_t elapsedNanos;
+
+/** @brief The number of heap allocations made by the benchmarking thread. */
+@property (nonatomic, readonly) uint64_t allocations;
+
+/** @brief The average time of a single operation in nanoseconds. */
+@property (nonatomic, readonly) double nanosPerOperation;
+
+/** @brief The average number of heap allocations of a single operation. */
+@property (nonatomic, readonly) double allocationsPerOperation;
+
+@end
+
+/**
+ A latency histogram with logarithmic buckets of about 1.5% precision, cheap enough to record
+ every single operation. A histogram isn't thread-safe, every worker thread records into its
+ own histogram and the results are merged afterwards.
+ */
+@interface RocksDBBenchmarkHistogram : NSObject
+
+/** @brief The number of recorded values. */
+@property (nonatomic, readonly) uint64_t count;
+
+/** @brief The sum of the recorded values. */
+@property (nonatomic, readonly) uint64_t sum;
+
+/** @brief The smallest recorded value. */
+@property (nonatomic, readonly) uint64_t min;
+
+/** @brief The largest recorded value. */
+@property (nonatomic, readonly) uint64_t max;
+
+/** @brief The average of the recorded values. */
+@property (nonatomic, readonly) double average;
+
+/** @brief Records a latency in nanoseconds. */
+- (void)recordNanos:(uint64_t)nanos;
+
+/** @brief Adds the values recorded by another histogram to this one. */
+- (void)mergeHistogram:(RocksDBBenchmarkHistogram *)histogram;
+
+/** @brief Returns the value below which the given percentage of the recorded values fall. */
+- (uint64_t)percentile:(double)percentile;
+
+/** @brief Enumerates the non-empty buckets in ascending order, with their value range and count. */
+- (void)enumerateBucketsUsingBlock:(void (^)(uint64_t lower, uint64_t upper, uint64_t count))block;
+
+@end
+
+/**
+ Common utilities of the benchmark suites.
+ */
+@interface RocksDBBenchmark : NSObject
+
+/**
+ Runs the given block once, counting its wall-clock time and the heap allocations made on
+ the calling thread.
+
+ @param name The name of the measured operation.
+ @param operations The number of operations executed by the block.
+ @param block The block to measure.
+ @return The measurement.
+ */
++ (RocksDBBenchmarkMeasurement *)measure:(NSString *)name
+							  operations:(NSUInteger)operations
+							  usingBlock:(void (^)(void))block;
+
+/**
+ Returns a fixed-width, zero-padded key for the given index, so that the keys sort in index order.
+ */
++ (NSData *)keyForIndex:(uint64_t)index;
+
+/**
+ Returns a value of the given size filled with pseudo-random, poorly compressible bytes.
+ */
++ (NSData *)valueOfSize:(size_t)size seed:(uint64_t)seed;
+
+/**
+ Returns a fresh directory for a benchmark database below the given root path, removing any
+ leftovers of a previous run.
+ */
++ (NSString *)databasePathWithName:(NSString *)name inDirectory:(NSString *)directory;
+
+@end
+
+/** @brief The command line flags, given as `--name=value`. */
+typedef NSDictionary<NSString *, NSString *> RocksDBBenchmarkFlags;
+
+extern uint64_t RocksDBBenchmarkFlagUInt64(RocksDBBenchmarkFlags *flags, NSString *name, uint64_t defaultValue);
+extern double RocksDBBenchmarkFlagDouble(RocksDBBenchmarkFlags *flags, NSString *name, double defaultValue);
+extern NSString *RocksDBBenchmarkFlagString(RocksDBBenchmarkFlags *flags, NSString *name, NSString *defaultValue);
+
+/**
+ Compares the cost of the ObjectiveRocks API with the same operations executed directly on
+ `rocksdb::DB`, reporting ns/op, allocations per op and the overhead ratio.
+
+ Flags: `--num`, `--value_size`, `--batch_size`, `--db`.
+ */
+extern int RocksDBRunOverheadBenchmark(RocksDBBenchmarkFlags *flags);
+
+/**
+ A `db_bench`-style benchmark driven through the ObjectiveRocks API, reporting the throughput and
+ the p50/p99/p99.9 latencies of each benchmark.
+
+ Flags: `--benchmarks`, `--num`, `--reads`, `--threads`, `--key_size`, `--value_size`,
+ `--value_size_distribution`, `--value_size_min`, `--value_size_max`, `--seek_nexts`, `--seed`,
+ `--db`, `--use_existing_db` and the option flags listed by the usage.
+ */
+extern int RocksDBRunDBBenchmark(RocksDBBenchmarkFlags *flags);
+
+/**
+ Runs the YCSB core workloads A to F through the ObjectiveRocks API, reporting latency histograms
+ per operation type.
+
+ Flags: `--workload`, `--recordcount`, `--operationcount`, `--threads`, `--fieldcount`,
+ `--fieldlength`, `--requestdistribution`, `--readproportion`, `--updateproportion`,
+ `--insertproportion`, `--scanproportion`, `--readmodifywriteproportion`, `--maxscanlength`,
+ `--histogram`, `--seed`, `--db`.
+ */
+extern int RocksDBRunYCSBBenchmark(RocksDBBenchmarkFlags *flags);
+
+NS_ASSUME_NONNULL_END
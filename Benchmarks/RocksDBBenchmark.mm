@@ -0,0 +1,262 @@
+//
+//  RocksDBBenchmark.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBBenchmark.h"
+
+#include <atomic>
+#include <chrono>
+#include <pthread.h>
+#include <vector>
+
+#pragma mark - Allocation Counting
+
+// The hook that libmalloc calls for every allocation when malloc stack logging is enabled, see
+// libmalloc's stack_logging.h. It is the only way to observe allocations of all zones, including
+// the ones made by the Objective-C runtime, without interposing the allocator.
+typedef void (malloc_logger_t)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t num_hot_frames_to_skip);
+extern "C" malloc_logger_t *malloc_logger;
+
+static const uint32_t RocksDBMallocLogTypeAllocate = 2;
+
+static pthread_t RocksDBCountingThread;
+static std::atomic<uint64_t> RocksDBAllocationCount(0);
+
+static void RocksDBCountingMallocLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t num_hot_frames_to_skip)
+{
+	// Only the benchmarking thread is counted, the background flushes and compactions aren't
+	if ((type & RocksDBMallocLogTypeAllocate) && pthread_equal(pthread_self(), RocksDBCountingThread)) {
+		RocksDBAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+#pragma mark - Measurement
+
+@implementation RocksDBBenchmarkMeasurement
+
+- (instancetype)initWithName:(NSString *)name
+				  operations:(NSUInteger)operations
+				elapsedNanos:(uint64_t)elapsedNanos
+				 allocations:(uint64_t)allocations
+{
+	self = [super init];
+	if (self) {
+		_name = [name copy];
+		_operations = operations;
+		_elapsedNanos = elapsedNanos;
+		_allocations = allocations;
+	}
+	return self;
+}
+
+- (double)nanosPerOperation
+{
+	return _operations > 0 ? (double)_elapsedNanos / _operations : 0;
+}
+
+- (double)allocationsPerOperation
+{
+	return _operations > 0 ? (double)_allocations / _operations : 0;
+}
+
+- (NSString *)description
+{
+	return [NSString stringWithFormat:@"<Measurement %@: %lu ops, %.1f ns/op, %.2f allocs/op>",
+			_name, (unsigned long)_operations, self.nanosPerOperation, self.allocationsPerOperation];
+}
+
+@end
+
+#pragma mark - Histogram
+
+// Values below 2^6 get their own bucket, larger ones share 64 buckets per power of two
+static const int RocksDBHistogramSubBucketBits = 6;
+static const size_t RocksDBHistogramBucketCount = (64 - RocksDBHistogramSubBucketBits + 1) << RocksDBHistogramSubBucketBits;
+
+static size_t RocksDBHistogramBucketIndex(uint64_t value)
+{
+	if (value < (1ULL << RocksDBHistogramSubBucketBits)) {
+		return (size_t)value;
+	}
+	int exponent = 63 - __builtin_clzll(value);
+	int shift = exponent - RocksDBHistogramSubBucketBits;
+	uint64_t subBucket = (value >> shift) - (1ULL << RocksDBHistogramSubBucketBits);
+	return ((size_t)(shift + 1) << RocksDBHistogramSubBucketBits) + (size_t)subBucket;
+}
+
+static uint64_t RocksDBHistogramBucketLowerBound(size_t index)
+{
+	if (index < (1ULL << RocksDBHistogramSubBucketBits)) {
+		return index;
+	}
+	int shift = (int)(index >> RocksDBHistogramSubBucketBits) - 1;
+	uint64_t subBucket = index & ((1ULL << RocksDBHistogramSubBucketBits) - 1);
+	return ((1ULL << RocksDBHistogramSubBucketBits) + subBucket) << shift;
+}
+
+static uint64_t RocksDBHistogramBucketValue(size_t index)
+{
+	if (index < (1ULL << RocksDBHistogramSubBucketBits)) {
+		return index;
+	}
+	// The middle of the bucket
+	int shift = (int)(index >> RocksDBHistogramSubBucketBits) - 1;
+	return RocksDBHistogramBucketLowerBound(index) + (((1ULL << shift) - 1) >> 1);
+}
+
+@interface RocksDBBenchmarkHistogram ()
+{
+	std::vector<uint64_t> _buckets;
+}
+@end
+
+@implementation RocksDBBenchmarkHistogram
+
+- (instancetype)init
+{
+	self = [super init];
+	if (self) {
+		_buckets.resize(RocksDBHistogramBucketCount, 0);
+		_min = UINT64_MAX;
+	}
+	return self;
+}
+
+- (void)recordNanos:(uint64_t)nanos
+{
+	_buckets[RocksDBHistogramBucketIndex(nanos)]++;
+	_count++;
+	_sum += nanos;
+	_min = MIN(_min, nanos);
+	_max = MAX(_max, nanos);
+}
+
+- (void)mergeHistogram:(RocksDBBenchmarkHistogram *)histogram
+{
+	for (size_t i = 0; i < RocksDBHistogramBucketCount; i++) {
+		_buckets[i] += histogram->_buckets[i];
+	}
+	_count += histogram.count;
+	_sum += histogram.sum;
+	_min = MIN(_min, histogram->_min);
+	_max = MAX(_max, histogram.max);
+}
+
+- (uint64_t)min
+{
+	return _count > 0 ? _min : 0;
+}
+
+- (double)average
+{
+	return _count > 0 ? (double)_sum / _count : 0;
+}
+
+- (uint64_t)percentile:(double)percentile
+{
+	if (_count == 0) {
+		return 0;
+	}
+
+	uint64_t threshold = (uint64_t)ceil(_count * MIN(MAX(percentile, 0.0), 100.0) / 100.0);
+	uint64_t cumulative = 0;
+	for (size_t i = 0; i < RocksDBHistogramBucketCount; i++) {
+		cumulative += _buckets[i];
+		if (cumulative >= MAX(threshold, (uint64_t)1)) {
+			return MIN(MAX(RocksDBHistogramBucketValue(i), self.min), _max);
+		}
+	}
+	return _max;
+}
+
+- (void)enumerateBucketsUsingBlock:(void (^)(uint64_t lower, uint64_t upper, uint64_t count))block
+{
+	for (size_t i = 0; i < RocksDBHistogramBucketCount; i++) {
+		if (_buckets[i] == 0) {
+			continue;
+		}
+		uint64_t lower = RocksDBHistogramBucketLowerBound(i);
+		uint64_t upper = i + 1 < RocksDBHistogramBucketCount ? RocksDBHistogramBucketLowerBound(i + 1) - 1 : UINT64_MAX;
+		block(lower, upper, _buckets[i]);
+	}
+}
+
+@end
+
+#pragma mark - Benchmark
+
+@implementation RocksDBBenchmark
+
++ (RocksDBBenchmarkMeasurement *)measure:(NSString *)name
+							  operations:(NSUInteger)operations
+							  usingBlock:(void (^)(void))block
+{
+	RocksDBCountingThread = pthread_self();
+	RocksDBAllocationCount.store(0);
+	malloc_logger = RocksDBCountingMallocLogger;
+
+	auto start = std::chrono::steady_clock::now();
+	block();
+	auto end = std::chrono::steady_clock::now();
+
+	malloc_logger = NULL;
+	uint64_t allocations = RocksDBAllocationCount.load();
+	uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+	return [[RocksDBBenchmarkMeasurement alloc] initWithName:name
+												  operations:operations
+												elapsedNanos:elapsed
+												 allocations:allocations];
+}
+
++ (NSData *)keyForIndex:(uint64_t)index
+{
+	char buffer[17];
+	snprintf(buffer, sizeof(buffer), "%016llu", (unsigned long long)index);
+	return [NSData dataWithBytes:buffer length:16];
+}
+
++ (NSData *)valueOfSize:(size_t)size seed:(uint64_t)seed
+{
+	NSMutableData *value = [NSMutableData dataWithLength:size];
+	uint8_t *bytes = (uint8_t *)value.mutableBytes;
+	uint64_t state = seed * 0x9E3779B97F4A7C15ULL + 1;
+	for (size_t i = 0; i < size; i++) {
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		bytes[i] = (uint8_t)state;
+	}
+	return value;
+}
+
++ (NSString *)databasePathWithName:(NSString *)name inDirectory:(NSString *)directory
+{
+	NSString *path = [directory stringByAppendingPathComponent:name];
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+	[[NSFileManager defaultManager] createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:nil];
+	return path;
+}
+
+@end
+
+#pragma mark - Flags
+
+uint64_t RocksDBBenchmarkFlagUInt64(RocksDBBenchmarkFlags *flags, NSString *name, uint64_t defaultValue)
+{
+	NSString *value = flags[name];
+	return value != nil ? strtoull(value.UTF8String, NULL, 10) : defaultValue;
+}
+
+double RocksDBBenchmarkFlagDouble(RocksDBBenchmarkFlags *flags, NSString *name, double defaultValue)
+{
+	NSString *value = flags[name];
+	return value != nil ? value.doubleValue : defaultValue;
+}
+
+NSString *RocksDBBenchmarkFlagString(RocksDBBenchmarkFlags *flags, NSString *name, NSString *defaultValue)
+{
+	NSString *value = flags[name];
+	return value ?: defaultValue;
+}
@@ -0,0 +1,430 @@
+//
+//  RocksDBDBBenchmark.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBBenchmark.h"
+#import "RocksDB.h"
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#pragma mark - Configuration
+
+static NSString * const RocksDBDBBenchmarkDefaultBenchmarks = @"fillseq,fillrandom,overwrite,readrandom,readwhilewriting,seekrandom,mergerandom,deleterandom";
+
+typedef NS_ENUM(NSUInteger, RocksDBValueSizeDistribution)
+{
+	RocksDBValueSizeDistributionFixed,
+	RocksDBValueSizeDistributionUniform,
+	RocksDBValueSizeDistributionNormal
+};
+
+typedef struct {
+	uint64_t num;
+	uint64_t reads;
+	int threads;
+	size_t keySize;
+	size_t valueSize;
+	size_t valueSizeMin;
+	size_t valueSizeMax;
+	RocksDBValueSizeDistribution valueSizeDistribution;
+	int seekNexts;
+	uint64_t seed;
+} RocksDBDBBenchmarkConfig;
+
+static RocksDBCompressionType CompressionTypeFromFlag(NSString *name)
+{
+	NSDictionary<NSString *, NSNumber *> *types = @{
+		@"none": @(RocksDBCompressionNone),
+		@"snappy": @(RocksDBCompressionSnappy),
+		@"zlib": @(RocksDBCompressionZlib),
+		@"bzip2": @(RocksDBCompressionBZip2),
+		@"lz4": @(RocksDBCompressionLZ4),
+		@"lz4hc": @(RocksDBCompressionLZ4HC),
+		@"xpress": @(RocksDBCompressionXpress),
+		@"zstd": @(RocksDBCompressionZSTD)
+	};
+	NSNumber *type = types[name.lowercaseString];
+	return type != nil ? (RocksDBCompressionType)type.charValue : RocksDBCompressionSnappy;
+}
+
+static RocksDBOptions *OptionsFromFlags(RocksDBBenchmarkFlags *flags, RocksDBEnv *env)
+{
+	RocksDBOptions *options = [RocksDBOptions new];
+	options.createIfMissing = YES;
+	options.env = env;
+	options.maxOpenFiles = (int)RocksDBBenchmarkFlagUInt64(flags, @"open_files", 1000);
+	options.writeBufferSize = (size_t)RocksDBBenchmarkFlagUInt64(flags, @"write_buffer_size", 64 << 20);
+	options.maxWriteBufferNumber = (int)RocksDBBenchmarkFlagUInt64(flags, @"max_write_buffer_number", 2);
+	options.level0FileNumCompactionTrigger = (int)RocksDBBenchmarkFlagUInt64(flags, @"level0_file_num_compaction_trigger", 4);
+	options.level0SlowdownWritesTrigger = (int)RocksDBBenchmarkFlagUInt64(flags, @"level0_slowdown_writes_trigger", 20);
+	options.level0StopWritesTrigger = (int)RocksDBBenchmarkFlagUInt64(flags, @"level0_stop_writes_trigger", 36);
+	options.targetFileSizeBase = RocksDBBenchmarkFlagUInt64(flags, @"target_file_size_base", 64 << 20);
+	options.maxBytesForLevelBase = RocksDBBenchmarkFlagUInt64(flags, @"max_bytes_for_level_base", 256 << 20);
+	options.compressionType = CompressionTypeFromFlag(RocksDBBenchmarkFlagString(flags, @"compression_type", @"snappy"));
+	options.disableAutoCompactions = RocksDBBenchmarkFlagUInt64(flags, @"disable_auto_compactions", 0) != 0;
+
+	if (RocksDBBenchmarkFlagUInt64(flags, @"statistics", 0) != 0) {
+		options.statistics = [RocksDBStatistics new];
+	}
+
+	uint64_t cacheSize = RocksDBBenchmarkFlagUInt64(flags, @"cache_size", 8 << 20);
+	size_t blockSize = (size_t)RocksDBBenchmarkFlagUInt64(flags, @"block_size", 4096);
+	int bloomBits = (int)RocksDBBenchmarkFlagDouble(flags, @"bloom_bits", -1);
+	BOOL cacheIndexAndFilterBlocks = RocksDBBenchmarkFlagUInt64(flags, @"cache_index_and_filter_blocks", 0) != 0;
+	options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *tableOptions) {
+		tableOptions.blockCache = [RocksDBCache LRUCacheWithCapacity:cacheSize];
+		tableOptions.blockSize = blockSize;
+		tableOptions.cacheIndexAndFilterBlocks = cacheIndexAndFilterBlocks;
+		if (bloomBits >= 0) {
+			tableOptions.filterPolicy = [RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:bloomBits];
+		}
+	}];
+
+	options.mergeOperator = [RocksDBMergeOperator operatorWithName:@"ObjectiveRocks.Benchmark.UInt64Add"
+														  andBlock:^NSData *(NSData *key, NSData *existingValue, NSData *value) {
+		uint64_t existing = 0, operand = 0;
+		if (existingValue.length == sizeof(uint64_t)) {
+			[existingValue getBytes:&existing length:sizeof(uint64_t)];
+		}
+		if (value.length == sizeof(uint64_t)) {
+			[value getBytes:&operand length:sizeof(uint64_t)];
+		}
+		uint64_t sum = existing + operand;
+		return [NSData dataWithBytes:&sum length:sizeof(uint64_t)];
+	}];
+
+	return options;
+}
+
+#pragma mark - Generators
+
+// Generates the keys and values of a single worker thread
+class RocksDBDBBenchmarkGenerator
+{
+private:
+	const RocksDBDBBenchmarkConfig &config;
+	std::mt19937_64 random;
+	std::normal_distribution<double> normal;
+	NSData *valueBuffer;
+
+public:
+	RocksDBDBBenchmarkGenerator(const RocksDBDBBenchmarkConfig &config, NSData *valueBuffer, uint64_t seed):
+	config(config), random(seed), normal((double)config.valueSize, MAX((double)(config.valueSizeMax - config.valueSizeMin) / 4, 1.0)), valueBuffer(valueBuffer) {}
+
+	uint64_t NextIndex()
+	{
+		return random() % MAX(config.num, (uint64_t)1);
+	}
+
+	NSData *Key(uint64_t index)
+	{
+		// Zero-padded decimal keys sort in index order, as with db_bench
+		char buffer[64];
+		int length = snprintf(buffer, sizeof(buffer), "%0*llu", (int)MIN(config.keySize, sizeof(buffer) - 1), (unsigned long long)index);
+		return [NSData dataWithBytes:buffer length:MIN((size_t)length, config.keySize)];
+	}
+
+	NSData *Value()
+	{
+		size_t size = config.valueSize;
+		switch (config.valueSizeDistribution) {
+			case RocksDBValueSizeDistributionFixed:
+				break;
+			case RocksDBValueSizeDistributionUniform:
+				size = config.valueSizeMin + random() % (config.valueSizeMax - config.valueSizeMin + 1);
+				break;
+			case RocksDBValueSizeDistributionNormal:
+				size = (size_t)MIN(MAX(normal(random), (double)config.valueSizeMin), (double)config.valueSizeMax);
+				break;
+		}
+
+		// Values are slices of a shared random buffer, which is twice as large as the largest value
+		size_t offset = random() % (valueBuffer.length - size + 1);
+		return [NSData dataWithBytesNoCopy:(uint8_t *)valueBuffer.bytes + offset length:size freeWhenDone:NO];
+	}
+};
+
+#pragma mark - Runner
+
+typedef void (^RocksDBDBBenchmarkOperation)(RocksDBDBBenchmarkGenerator &generator, uint64_t index, uint64_t *bytes, uint64_t *found);
+
+static uint64_t NowNanos()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void PrintReport(NSString *name, uint64_t operations, uint64_t elapsed, uint64_t bytes, uint64_t found, uint64_t lookups, RocksDBBenchmarkHistogram *histogram)
+{
+	double seconds = elapsed / 1e9;
+	double opsPerSecond = seconds > 0 ? operations / seconds : 0;
+	printf("%-17s : %11.3f micros/op %9.0f ops/sec;", name.UTF8String,
+		   operations > 0 ? elapsed / 1e3 / operations : 0, opsPerSecond);
+	if (bytes > 0 && seconds > 0) {
+		printf(" %6.1f MB/s;", bytes / 1048576.0 / seconds);
+	}
+	printf(" p50 %.2f p99 %.2f p99.9 %.2f micros",
+		   [histogram percentile:50] / 1e3, [histogram percentile:99] / 1e3, [histogram percentile:99.9] / 1e3);
+	if (lookups > 0) {
+		printf(" (%llu of %llu found)", (unsigned long long)found, (unsigned long long)lookups);
+	}
+	printf("\n");
+}
+
+static void RunOperation(NSString *name,
+						 const RocksDBDBBenchmarkConfig &config,
+						 NSData *valueBuffer,
+						 uint64_t operationsPerThread,
+						 BOOL sequential,
+						 BOOL countsLookups,
+						 RocksDBDBBenchmarkOperation operation,
+						 RocksDBDBBenchmarkOperation backgroundWriter)
+{
+	std::vector<std::thread> threads;
+	NSMutableArray<RocksDBBenchmarkHistogram *> *histograms = [NSMutableArray array];
+	std::vector<uint64_t> bytes(config.threads, 0);
+	std::vector<uint64_t> found(config.threads, 0);
+	std::atomic<bool> done(false);
+
+	for (int t = 0; t < config.threads; t++) {
+		[histograms addObject:[RocksDBBenchmarkHistogram new]];
+	}
+
+	// The writer of readwhilewriting runs until the measured threads are done, and isn't reported
+	std::thread writer;
+	if (backgroundWriter != nil) {
+		writer = std::thread([&]() {
+			RocksDBDBBenchmarkGenerator generator(config, valueBuffer, config.seed + config.threads);
+			uint64_t writerBytes = 0, writerFound = 0;
+			while (!done.load(std::memory_order_relaxed)) {
+				@autoreleasepool {
+					backgroundWriter(generator, generator.NextIndex(), &writerBytes, &writerFound);
+				}
+			}
+		});
+	}
+
+	uint64_t start = NowNanos();
+	for (int t = 0; t < config.threads; t++) {
+		RocksDBBenchmarkHistogram *histogram = histograms[t];
+		threads.emplace_back([&, t, histogram]() {
+			RocksDBDBBenchmarkGenerator generator(config, valueBuffer, config.seed + t);
+			uint64_t first = t * operationsPerThread;
+			for (uint64_t i = 0; i < operationsPerThread; i++) {
+				@autoreleasepool {
+					uint64_t index = sequential ? first + i : generator.NextIndex();
+					uint64_t operationStart = NowNanos();
+					operation(generator, index, &bytes[t], &found[t]);
+					[histogram recordNanos:NowNanos() - operationStart];
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	uint64_t elapsed = NowNanos() - start;
+
+	done.store(true);
+	if (writer.joinable()) {
+		writer.join();
+	}
+
+	RocksDBBenchmarkHistogram *histogram = [RocksDBBenchmarkHistogram new];
+	uint64_t totalBytes = 0, totalFound = 0;
+	for (int t = 0; t < config.threads; t++) {
+		[histogram mergeHistogram:histograms[t]];
+		totalBytes += bytes[t];
+		totalFound += found[t];
+	}
+
+	uint64_t operations = operationsPerThread * config.threads;
+	PrintReport(name, operations, elapsed, totalBytes, totalFound, countsLookups ? operations : 0, histogram);
+}
+
+#pragma mark - Benchmark
+
+int RocksDBRunDBBenchmark(RocksDBBenchmarkFlags *flags)
+{
+	RocksDBDBBenchmarkConfig config;
+	config.num = RocksDBBenchmarkFlagUInt64(flags, @"num", 1000000);
+	config.reads = RocksDBBenchmarkFlagUInt64(flags, @"reads", config.num);
+	config.threads = (int)MAX(RocksDBBenchmarkFlagUInt64(flags, @"threads", 1), (uint64_t)1);
+	config.keySize = (size_t)MIN(MAX(RocksDBBenchmarkFlagUInt64(flags, @"key_size", 16), (uint64_t)1), (uint64_t)63);
+
+	// Keys shorter than the largest index would lose its leading digits and collide
+	size_t indexDigits = 1;
+	for (uint64_t index = MAX(config.num, (uint64_t)1) - 1; index >= 10; index /= 10) {
+		indexDigits++;
+	}
+	config.keySize = MAX(config.keySize, indexDigits);
+
+	config.valueSize = (size_t)RocksDBBenchmarkFlagUInt64(flags, @"value_size", 100);
+	config.valueSizeMin = (size_t)RocksDBBenchmarkFlagUInt64(flags, @"value_size_min", config.valueSize);
+	config.valueSizeMax = (size_t)MAX(RocksDBBenchmarkFlagUInt64(flags, @"value_size_max", config.valueSize), (uint64_t)config.valueSizeMin);
+	config.seekNexts = (int)RocksDBBenchmarkFlagUInt64(flags, @"seek_nexts", 0);
+	config.seed = RocksDBBenchmarkFlagUInt64(flags, @"seed", 301);
+
+	NSString *distribution = RocksDBBenchmarkFlagString(flags, @"value_size_distribution", @"fixed");
+	if ([distribution isEqualToString:@"uniform"]) {
+		config.valueSizeDistribution = RocksDBValueSizeDistributionUniform;
+	} else if ([distribution isEqualToString:@"normal"]) {
+		config.valueSizeDistribution = RocksDBValueSizeDistributionNormal;
+	} else {
+		config.valueSizeDistribution = RocksDBValueSizeDistributionFixed;
+		config.valueSizeMin = config.valueSizeMax = config.valueSize;
+	}
+	config.valueSize = MIN(MAX(config.valueSize, config.valueSizeMin), config.valueSizeMax);
+
+	NSString *directory = RocksDBBenchmarkFlagString(flags, @"db", [NSTemporaryDirectory() stringByAppendingPathComponent:@"ObjectiveRocksBenchmarks"]);
+	NSString *path = [directory stringByAppendingPathComponent:@"dbbench"];
+	BOOL useExistingDB = RocksDBBenchmarkFlagUInt64(flags, @"use_existing_db", 0) != 0;
+	BOOL reuseIterator = RocksDBBenchmarkFlagUInt64(flags, @"reuse_iterator", 0) != 0;
+
+	// The options hold on to the env without retaining it
+	RocksDBEnv *env = [RocksDBEnv envWithLowPriorityThreadCount:(int)RocksDBBenchmarkFlagUInt64(flags, @"max_background_compactions", 2)
+									 andHighPriorityThreadCount:(int)RocksDBBenchmarkFlagUInt64(flags, @"max_background_flushes", 1)];
+	RocksDBOptions *options = OptionsFromFlags(flags, env);
+
+	RocksDBWriteOptions *writeOptions = [RocksDBWriteOptions new];
+	writeOptions.syncWrites = RocksDBBenchmarkFlagUInt64(flags, @"sync", 0) != 0;
+	writeOptions.disableWriteAheadLog = RocksDBBenchmarkFlagUInt64(flags, @"disable_wal", 0) != 0;
+
+	RocksDBReadOptions *readOptions = [RocksDBReadOptions new];
+	readOptions.verifyChecksums = RocksDBBenchmarkFlagUInt64(flags, @"verify_checksum", 1) != 0;
+
+	NSData *valueBuffer = [RocksDBBenchmark valueOfSize:MAX(config.valueSizeMax, (size_t)1) * 2 seed:config.seed];
+
+	printf("Keys:       %zu bytes each\n", config.keySize);
+	printf("Values:     %zu bytes each (%s, %zu..%zu)\n", config.valueSize, distribution.UTF8String, config.valueSizeMin, config.valueSizeMax);
+	printf("Entries:    %llu\n", (unsigned long long)config.num);
+	printf("Threads:    %d\n", config.threads);
+	printf("------------------------------------------------\n");
+
+	__block RocksDB *db = nil;
+	BOOL (^openDatabase)(BOOL) = ^BOOL(BOOL fresh) {
+		[db close];
+		if (fresh) {
+			[RocksDB destroyDatabaseAtPath:path andOptions:options error:nil];
+		}
+		[[NSFileManager defaultManager] createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:nil];
+
+		NSError *error = nil;
+		db = [RocksDB databaseAtPath:path andOptions:options error:&error];
+		if (db == nil) {
+			fprintf(stderr, "Failed to open %s: %s\n", path.UTF8String, error.localizedDescription.UTF8String);
+			return NO;
+		}
+		[db setDefaultReadOptions:readOptions writeOptions:writeOptions];
+		return YES;
+	};
+
+	if (!openDatabase(!useExistingDB)) {
+		return 1;
+	}
+
+	uint64_t writesPerThread = MAX(config.num / config.threads, (uint64_t)1);
+	uint64_t readsPerThread = MAX(config.reads / config.threads, (uint64_t)1);
+	uint64_t one = 1;
+	NSData *operand = [NSData dataWithBytes:&one length:sizeof(uint64_t)];
+
+	RocksDBDBBenchmarkOperation writeOperation = ^(RocksDBDBBenchmarkGenerator &generator, uint64_t index, uint64_t *bytes, uint64_t *found) {
+		NSData *key = generator.Key(index);
+		NSData *value = generator.Value();
+		[db setData:value forKey:key error:nil];
+		*bytes += key.length + value.length;
+	};
+
+	RocksDBDBBenchmarkOperation readOperation = ^(RocksDBDBBenchmarkGenerator &generator, uint64_t index, uint64_t *bytes, uint64_t *found) {
+		NSData *key = generator.Key(index);
+		NSData *value = [db dataForKey:key error:nil];
+		if (value != nil) {
+			*bytes += key.length + value.length;
+			*found += 1;
+		}
+	};
+
+	NSArray<NSString *> *benchmarks = [RocksDBBenchmarkFlagString(flags, @"benchmarks", RocksDBDBBenchmarkDefaultBenchmarks) componentsSeparatedByString:@","];
+	for (NSString *benchmark in benchmarks) {
+		NSString *name = [benchmark stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+
+		if ([name isEqualToString:@"fillseq"]) {
+			if (!openDatabase(YES)) {
+				return 1;
+			}
+			RunOperation(name, config, valueBuffer, writesPerThread, YES, NO, writeOperation, nil);
+		} else if ([name isEqualToString:@"fillrandom"]) {
+			if (!openDatabase(YES)) {
+				return 1;
+			}
+			RunOperation(name, config, valueBuffer, writesPerThread, NO, NO, writeOperation, nil);
+		} else if ([name isEqualToString:@"overwrite"]) {
+			RunOperation(name, config, valueBuffer, writesPerThread, NO, NO, writeOperation, nil);
+		} else if ([name isEqualToString:@"readrandom"]) {
+			RunOperation(name, config, valueBuffer, readsPerThread, NO, YES, readOperation, nil);
+		} else if ([name isEqualToString:@"readwhilewriting"]) {
+			RunOperation(name, config, valueBuffer, readsPerThread, NO, YES, readOperation, writeOperation);
+		} else if ([name isEqualToString:@"seekrandom"]) {
+			// Iterators are per thread, so a reused iterator is kept by its generator's thread
+			NSMapTable<NSThread *, RocksDBIterator *> *iterators = [NSMapTable strongToStrongObjectsMapTable];
+			NSLock *lock = [NSLock new];
+			int seekNexts = config.seekNexts;
+			RunOperation(name, config, valueBuffer, readsPerThread, NO, YES, ^(RocksDBDBBenchmarkGenerator &generator, uint64_t index, uint64_t *bytes, uint64_t *found) {
+				RocksDBIterator *iterator = nil;
+				if (reuseIterator) {
+					[lock lock];
+					iterator = [iterators objectForKey:[NSThread currentThread]];
+					if (iterator == nil) {
+						iterator = [db iteratorWithReadOptions:readOptions];
+						[iterators setObject:iterator forKey:[NSThread currentThread]];
+					}
+					[lock unlock];
+				} else {
+					iterator = [db iteratorWithReadOptions:readOptions];
+				}
+
+				NSData *key = generator.Key(index);
+				[iterator seekToKey:key];
+				if (iterator.isValid) {
+					*found += 1;
+					for (int n = 0; n <= seekNexts && iterator.isValid; n++) {
+						*bytes += iterator.key.length + iterator.value.length;
+						[iterator next];
+					}
+				}
+
+				if (!reuseIterator) {
+					[iterator close];
+				}
+			}, nil);
+			for (RocksDBIterator *iterator in iterators.objectEnumerator) {
+				[iterator close];
+			}
+		} else if ([name isEqualToString:@"mergerandom"]) {
+			RunOperation(name, config, valueBuffer, writesPerThread, NO, NO, ^(RocksDBDBBenchmarkGenerator &generator, uint64_t index, uint64_t *bytes, uint64_t *found) {
+				NSData *key = generator.Key(index);
+				[db mergeData:operand forKey:key error:nil];
+				*bytes += key.length + operand.length;
+			}, nil);
+		} else if ([name isEqualToString:@"deleterandom"]) {
+			RunOperation(name, config, valueBuffer, writesPerThread, NO, NO, ^(RocksDBDBBenchmarkGenerator &generator, uint64_t index, uint64_t *bytes, uint64_t *found) {
+				NSData *key = generator.Key(index);
+				[db deleteDataForKey:key error:nil];
+				*bytes += key.length;
+			}, nil);
+		} else if (name.length > 0) {
+			fprintf(stderr, "Unknown benchmark '%s'\n", name.UTF8String);
+		}
+	}
+
+	if (options.statistics != nil) {
+		printf("\nSTATISTICS:\n%s\n", options.statistics.description.UTF8String);
+	}
+
+	[db close];
+	return 0;
+}
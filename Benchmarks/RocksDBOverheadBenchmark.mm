@@ -0,0 +1,317 @@
+//
+//  RocksDBOverheadBenchmark.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBBenchmark.h"
+#import "RocksDB.h"
+
+#import <rocksdb/comparator.h>
+#import <rocksdb/db.h>
+#import <rocksdb/merge_operator.h>
+#import <rocksdb/options.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#pragma mark - Native Callbacks
+
+// The native counterparts of the block based merge operator and comparator used on the wrapper side
+
+class RocksDBBenchmarkUInt64AddOperator : public rocksdb::AssociativeMergeOperator
+{
+public:
+	virtual bool Merge(const rocksdb::Slice& key,
+					   const rocksdb::Slice* existing_value,
+					   const rocksdb::Slice& value,
+					   std::string* new_value,
+					   rocksdb::Logger* logger) const override
+	{
+		uint64_t existing = 0, operand = 0;
+		if (existing_value != nullptr && existing_value->size() == sizeof(uint64_t)) {
+			memcpy(&existing, existing_value->data(), sizeof(uint64_t));
+		}
+		if (value.size() == sizeof(uint64_t)) {
+			memcpy(&operand, value.data(), sizeof(uint64_t));
+		}
+		uint64_t sum = existing + operand;
+		new_value->assign((const char *)&sum, sizeof(uint64_t));
+		return true;
+	}
+
+	virtual const char* Name() const override
+	{
+		return "ObjectiveRocks.Benchmark.UInt64Add";
+	}
+};
+
+class RocksDBBenchmarkBytewiseComparator : public rocksdb::Comparator
+{
+public:
+	virtual const char* Name() const override
+	{
+		return "ObjectiveRocks.Benchmark.Bytewise";
+	}
+
+	virtual int Compare(const rocksdb::Slice& a, const rocksdb::Slice& b) const override
+	{
+		return a.compare(b);
+	}
+
+	virtual void FindShortestSeparator(std::string* start, const rocksdb::Slice& limit) const override {}
+	virtual void FindShortSuccessor(std::string* key) const override {}
+};
+
+#pragma mark - Helpers
+
+static RocksDB *OpenWrapperDatabase(NSString *path, void (^configure)(RocksDBOptions *options))
+{
+	RocksDBOptions *options = [RocksDBOptions new];
+	options.createIfMissing = YES;
+	if (configure) {
+		configure(options);
+	}
+
+	NSError *error = nil;
+	RocksDB *db = [RocksDB databaseAtPath:path andOptions:options error:&error];
+	if (db == nil) {
+		fprintf(stderr, "Failed to open %s: %s\n", path.UTF8String, error.localizedDescription.UTF8String);
+	}
+	return db;
+}
+
+static rocksdb::DB *OpenNativeDatabase(NSString *path, void (^configure)(rocksdb::Options &options))
+{
+	rocksdb::Options options;
+	options.create_if_missing = true;
+	if (configure) {
+		configure(options);
+	}
+
+	rocksdb::DB *db = nullptr;
+	rocksdb::Status status = rocksdb::DB::Open(options, path.UTF8String, &db);
+	if (!status.ok()) {
+		fprintf(stderr, "Failed to open %s: %s\n", path.UTF8String, status.ToString().c_str());
+	}
+	return db;
+}
+
+static void PrintComparison(RocksDBBenchmarkMeasurement *wrapper, RocksDBBenchmarkMeasurement *native)
+{
+	double overhead = native.nanosPerOperation > 0 ? wrapper.nanosPerOperation / native.nanosPerOperation : 0;
+	printf("%-14s %12.1f %12.1f %9.2fx %14.2f %14.2f\n",
+		   wrapper.name.UTF8String,
+		   wrapper.nanosPerOperation, native.nanosPerOperation, overhead,
+		   wrapper.allocationsPerOperation, native.allocationsPerOperation);
+}
+
+#pragma mark - Benchmark
+
+int RocksDBRunOverheadBenchmark(RocksDBBenchmarkFlags *flags)
+{
+	NSUInteger num = (NSUInteger)RocksDBBenchmarkFlagUInt64(flags, @"num", 100000);
+	size_t valueSize = (size_t)RocksDBBenchmarkFlagUInt64(flags, @"value_size", 100);
+	NSUInteger batchSize = MAX((NSUInteger)RocksDBBenchmarkFlagUInt64(flags, @"batch_size", 16), (NSUInteger)1);
+	NSString *directory = RocksDBBenchmarkFlagString(flags, @"db", [NSTemporaryDirectory() stringByAppendingPathComponent:@"ObjectiveRocksBenchmarks"]);
+
+	// Both sides work on the same, pre-built keys and values, so that only the API call is measured.
+	// The native keys are __block, so that the blocks below share them instead of copying them.
+	NSMutableArray<NSData *> *keys = [NSMutableArray arrayWithCapacity:num];
+	__block std::vector<std::string> nativeKeys;
+	nativeKeys.reserve(num);
+	for (NSUInteger i = 0; i < num; i++) {
+		NSData *key = [RocksDBBenchmark keyForIndex:i];
+		[keys addObject:key];
+		nativeKeys.emplace_back((const char *)key.bytes, key.length);
+	}
+	NSData *value = [RocksDBBenchmark valueOfSize:valueSize seed:num];
+	std::string nativeValue((const char *)value.bytes, value.length);
+
+	uint64_t one = 1;
+	NSData *operand = [NSData dataWithBytes:&one length:sizeof(uint64_t)];
+	std::string nativeOperand((const char *)&one, sizeof(uint64_t));
+	NSUInteger mergeKeys = MAX(num / 10, (NSUInteger)1);
+
+	printf("Keys: %lu, value size: %zu, multiGet batch: %lu\n\n", (unsigned long)num, valueSize, (unsigned long)batchSize);
+	printf("%-14s %12s %12s %10s %14s %14s\n", "operation", "wrapper ns", "native ns", "overhead", "wrapper alloc", "native alloc");
+
+	// Get, Put, Delete, MultiGet and Iterator
+
+	NSString *wrapperPath = [RocksDBBenchmark databasePathWithName:@"overhead-wrapper" inDirectory:directory];
+	NSString *nativePath = [RocksDBBenchmark databasePathWithName:@"overhead-native" inDirectory:directory];
+	RocksDB *db = OpenWrapperDatabase(wrapperPath, nil);
+	rocksdb::DB *nativeDB = OpenNativeDatabase(nativePath, nil);
+	if (db == nil || nativeDB == nullptr) {
+		delete nativeDB;
+		return 1;
+	}
+
+	rocksdb::WriteOptions writeOptions;
+	rocksdb::ReadOptions readOptions;
+
+	PrintComparison([RocksDBBenchmark measure:@"put" operations:num usingBlock:^{
+		for (NSUInteger i = 0; i < num; i++) {
+			@autoreleasepool {
+				[db setData:value forKey:keys[i] error:nil];
+			}
+		}
+	}], [RocksDBBenchmark measure:@"put" operations:num usingBlock:^{
+		for (NSUInteger i = 0; i < num; i++) {
+			nativeDB->Put(writeOptions, nativeKeys[i], nativeValue);
+		}
+	}]);
+
+	PrintComparison([RocksDBBenchmark measure:@"get" operations:num usingBlock:^{
+		for (NSUInteger i = 0; i < num; i++) {
+			@autoreleasepool {
+				[db dataForKey:keys[i] error:nil];
+			}
+		}
+	}], [RocksDBBenchmark measure:@"get" operations:num usingBlock:^{
+		std::string result;
+		for (NSUInteger i = 0; i < num; i++) {
+			nativeDB->Get(readOptions, nativeKeys[i], &result);
+		}
+	}]);
+
+	PrintComparison([RocksDBBenchmark measure:@"multiGet" operations:num usingBlock:^{
+		for (NSUInteger i = 0; i < num; i += batchSize) {
+			@autoreleasepool {
+				[db multiGet:[keys subarrayWithRange:NSMakeRange(i, MIN(batchSize, num - i))]];
+			}
+		}
+	}], [RocksDBBenchmark measure:@"multiGet" operations:num usingBlock:^{
+		std::vector<rocksdb::Slice> batch;
+		std::vector<std::string> results;
+		for (NSUInteger i = 0; i < num; i += batchSize) {
+			batch.assign(nativeKeys.begin() + i, nativeKeys.begin() + MIN(i + batchSize, num));
+			nativeDB->MultiGet(readOptions, batch, &results);
+		}
+	}]);
+
+	PrintComparison([RocksDBBenchmark measure:@"scan" operations:num usingBlock:^{
+		@autoreleasepool {
+			RocksDBIterator *iterator = [db iterator];
+			[iterator enumerateKeysAndValuesUsingBlock:^(NSData *entryKey, NSData *entryValue, BOOL *stop) {}];
+			[iterator close];
+		}
+	}], [RocksDBBenchmark measure:@"scan" operations:num usingBlock:^{
+		std::unique_ptr<rocksdb::Iterator> iterator(nativeDB->NewIterator(readOptions));
+		for (iterator->SeekToFirst(); iterator->Valid(); iterator->Next()) {
+			// Copy the entry out of the iterator, as the wrapper does
+			std::string entryKey = iterator->key().ToString();
+			std::string entryValue = iterator->value().ToString();
+		}
+	}]);
+
+	PrintComparison([RocksDBBenchmark measure:@"delete" operations:num usingBlock:^{
+		for (NSUInteger i = 0; i < num; i++) {
+			@autoreleasepool {
+				[db deleteDataForKey:keys[i] error:nil];
+			}
+		}
+	}], [RocksDBBenchmark measure:@"delete" operations:num usingBlock:^{
+		for (NSUInteger i = 0; i < num; i++) {
+			nativeDB->Delete(writeOptions, nativeKeys[i]);
+		}
+	}]);
+
+	[db close];
+	delete nativeDB;
+
+	// Merge Operator
+
+	wrapperPath = [RocksDBBenchmark databasePathWithName:@"merge-wrapper" inDirectory:directory];
+	nativePath = [RocksDBBenchmark databasePathWithName:@"merge-native" inDirectory:directory];
+	db = OpenWrapperDatabase(wrapperPath, ^(RocksDBOptions *options) {
+		options.mergeOperator = [RocksDBMergeOperator operatorWithName:@"ObjectiveRocks.Benchmark.UInt64Add"
+															  andBlock:^NSData *(NSData *key, NSData *existingValue, NSData *mergeValue) {
+			uint64_t existing = 0, operand = 0;
+			if (existingValue.length == sizeof(uint64_t)) {
+				[existingValue getBytes:&existing length:sizeof(uint64_t)];
+			}
+			if (mergeValue.length == sizeof(uint64_t)) {
+				[mergeValue getBytes:&operand length:sizeof(uint64_t)];
+			}
+			uint64_t sum = existing + operand;
+			return [NSData dataWithBytes:&sum length:sizeof(uint64_t)];
+		}];
+	});
+	nativeDB = OpenNativeDatabase(nativePath, ^(rocksdb::Options &options) {
+		options.merge_operator = std::make_shared<RocksDBBenchmarkUInt64AddOperator>();
+	});
+	if (db == nil || nativeDB == nullptr) {
+		delete nativeDB;
+		return 1;
+	}
+
+	PrintComparison([RocksDBBenchmark measure:@"merge" operations:num usingBlock:^{
+		for (NSUInteger i = 0; i < num; i++) {
+			@autoreleasepool {
+				[db mergeData:operand forKey:keys[i % mergeKeys] error:nil];
+			}
+		}
+	}], [RocksDBBenchmark measure:@"merge" operations:num usingBlock:^{
+		for (NSUInteger i = 0; i < num; i++) {
+			nativeDB->Merge(writeOptions, nativeKeys[i % mergeKeys], nativeOperand);
+		}
+	}]);
+
+	// Reading the merged keys applies the stacked operands through the merge operator
+	PrintComparison([RocksDBBenchmark measure:@"mergeread" operations:mergeKeys usingBlock:^{
+		for (NSUInteger i = 0; i < mergeKeys; i++) {
+			@autoreleasepool {
+				[db dataForKey:keys[i] error:nil];
+			}
+		}
+	}], [RocksDBBenchmark measure:@"mergeread" operations:mergeKeys usingBlock:^{
+		std::string result;
+		for (NSUInteger i = 0; i < mergeKeys; i++) {
+			nativeDB->Get(readOptions, nativeKeys[i], &result);
+		}
+	}]);
+
+	[db close];
+	delete nativeDB;
+
+	// Comparator
+
+	wrapperPath = [RocksDBBenchmark databasePathWithName:@"comparator-wrapper" inDirectory:directory];
+	nativePath = [RocksDBBenchmark databasePathWithName:@"comparator-native" inDirectory:directory];
+	db = OpenWrapperDatabase(wrapperPath, ^(RocksDBOptions *options) {
+		options.comparator = [[RocksDBComparator alloc] initWithName:@"ObjectiveRocks.Benchmark.Bytewise"
+															andBlock:^int(RocksDBSlice *key1, RocksDBSlice *key2) {
+			return [key1 compare:key2];
+		}];
+	});
+	static RocksDBBenchmarkBytewiseComparator nativeComparator;
+	nativeDB = OpenNativeDatabase(nativePath, ^(rocksdb::Options &options) {
+		options.comparator = &nativeComparator;
+	});
+	if (db == nil || nativeDB == nullptr) {
+		delete nativeDB;
+		return 1;
+	}
+
+	// Insert in reverse order, so that every memtable insert walks the skiplist through the comparator
+	PrintComparison([RocksDBBenchmark measure:@"comparator" operations:num usingBlock:^{
+		for (NSUInteger i = num; i > 0; i--) {
+			@autoreleasepool {
+				[db setData:value forKey:keys[i - 1] error:nil];
+			}
+		}
+	}], [RocksDBBenchmark measure:@"comparator" operations:num usingBlock:^{
+		for (NSUInteger i = num; i > 0; i--) {
+			nativeDB->Put(writeOptions, nativeKeys[i - 1], nativeValue);
+		}
+	}]);
+
+	[db close];
+	delete nativeDB;
+
+	for (NSString *name in @[@"overhead-wrapper", @"overhead-native", @"merge-wrapper", @"merge-native", @"comparator-wrapper", @"comparator-native"]) {
+		[[NSFileManager defaultManager] removeItemAtPath:[directory stringByAppendingPathComponent:name] error:nil];
+	}
+	return 0;
+}
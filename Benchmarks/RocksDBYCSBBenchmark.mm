@@ -0,0 +1,410 @@
+//
+//  RocksDBYCSBBenchmark.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBBenchmark.h"
+#import "RocksDB.h"
+#import "RocksDBIndexedWriteBatch+getFromBatchAndDB.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+#pragma mark - Key Generators
+
+// The generators follow the YCSB core package, so that the workloads match the reference implementation
+
+static uint64_t FNVHash64(uint64_t value)
+{
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	for (int i = 0; i < 8; i++) {
+		hash ^= value & 0xFF;
+		hash *= 1099511628211ULL;
+		value >>= 8;
+	}
+	return hash;
+}
+
+// The zipfian generator of Gray et al., "Quickly Generating Billion-Record Synthetic Databases".
+// The item count may grow, e.g. with inserts, in which case zeta is updated incrementally.
+class RocksDBZipfianGenerator
+{
+private:
+	uint64_t items;
+	uint64_t base;
+	double theta;
+	double zeta2theta;
+	double alpha;
+	double zetan;
+	double eta;
+	uint64_t countForZeta;
+
+	static double Zeta(uint64_t start, uint64_t count, double theta, double initialSum)
+	{
+		double sum = initialSum;
+		for (uint64_t i = start; i < count; i++) {
+			sum += 1 / pow((double)(i + 1), theta);
+		}
+		return sum;
+	}
+
+public:
+	static constexpr double DefaultTheta = 0.99;
+
+	RocksDBZipfianGenerator(uint64_t min, uint64_t max, double theta = DefaultTheta, double zetan = -1):
+	items(max - min + 1), base(min), theta(theta), countForZeta(max - min + 1)
+	{
+		zeta2theta = Zeta(0, 2, theta, 0);
+		alpha = 1.0 / (1.0 - theta);
+		this->zetan = zetan >= 0 ? zetan : Zeta(0, items, theta, 0);
+		eta = (1 - pow(2.0 / items, 1 - theta)) / (1 - zeta2theta / this->zetan);
+	}
+
+	uint64_t Next(std::mt19937_64 &random, uint64_t itemCount)
+	{
+		if (itemCount > countForZeta) {
+			zetan = Zeta(countForZeta, itemCount, theta, zetan);
+			countForZeta = itemCount;
+			eta = (1 - pow(2.0 / items, 1 - theta)) / (1 - zeta2theta / zetan);
+		}
+
+		double u = std::uniform_real_distribution<double>(0, 1)(random);
+		double uz = u * zetan;
+		if (uz < 1.0) {
+			return base;
+		}
+		if (uz < 1.0 + pow(0.5, theta)) {
+			return base + 1;
+		}
+		return base + (uint64_t)(itemCount * pow(eta * u - eta + 1, alpha));
+	}
+
+	uint64_t Next(std::mt19937_64 &random)
+	{
+		return Next(random, countForZeta);
+	}
+};
+
+typedef NS_ENUM(NSUInteger, RocksDBYCSBDistribution)
+{
+	RocksDBYCSBDistributionUniform,
+	RocksDBYCSBDistributionZipfian,
+	RocksDBYCSBDistributionLatest
+};
+
+// Chooses the keys of the requests of a single worker thread
+class RocksDBYCSBKeyChooser
+{
+private:
+	RocksDBYCSBDistribution distribution;
+	uint64_t recordCount;
+	std::mt19937_64 &random;
+	RocksDBZipfianGenerator zipfian;
+
+	// The scrambled zipfian generator of YCSB draws from a fixed, huge item space with a precomputed
+	// zeta and hashes the result, so that the popular keys are spread over the key space
+	static constexpr uint64_t ScrambledItemCount = 10000000000ULL;
+	static constexpr double ScrambledZetan = 26.46902820178302;
+
+public:
+	RocksDBYCSBKeyChooser(RocksDBYCSBDistribution distribution, uint64_t recordCount, std::mt19937_64 &random):
+	distribution(distribution), recordCount(recordCount), random(random),
+	zipfian(distribution == RocksDBYCSBDistributionLatest
+			? RocksDBZipfianGenerator(0, MAX(recordCount, (uint64_t)1) - 1)
+			: RocksDBZipfianGenerator(0, ScrambledItemCount - 1, RocksDBZipfianGenerator::DefaultTheta, ScrambledZetan)) {}
+
+	uint64_t Next(uint64_t insertedCount)
+	{
+		uint64_t count = MAX(insertedCount, (uint64_t)1);
+		switch (distribution) {
+			case RocksDBYCSBDistributionUniform:
+				return random() % count;
+			case RocksDBYCSBDistributionZipfian:
+				// Only the initially loaded records are requested, as with YCSB's scrambled zipfian
+				return FNVHash64(zipfian.Next(random)) % MAX(recordCount, (uint64_t)1);
+			case RocksDBYCSBDistributionLatest: {
+				// The most recently inserted records are the most popular ones
+				uint64_t offset = zipfian.Next(random, count);
+				return count - 1 - MIN(offset, count - 1);
+			}
+		}
+		return 0;
+	}
+};
+
+#pragma mark - Workloads
+
+typedef NS_ENUM(NSUInteger, RocksDBYCSBOperation)
+{
+	RocksDBYCSBOperationRead,
+	RocksDBYCSBOperationUpdate,
+	RocksDBYCSBOperationInsert,
+	RocksDBYCSBOperationScan,
+	RocksDBYCSBOperationReadModifyWrite,
+	RocksDBYCSBOperationCount
+};
+
+static const char *RocksDBYCSBOperationNames[] = {"READ", "UPDATE", "INSERT", "SCAN", "READ-MODIFY-WRITE"};
+
+typedef struct {
+	double proportions[RocksDBYCSBOperationCount];
+	RocksDBYCSBDistribution distribution;
+} RocksDBYCSBWorkload;
+
+static BOOL WorkloadNamed(NSString *name, RocksDBYCSBWorkload *workload)
+{
+	// The core workloads as defined in YCSB's workloads/workload[a-f]
+	NSDictionary<NSString *, NSArray<NSNumber *> *> *workloads = @{
+		//         read   update insert scan   rmw    distribution
+		@"a": @[@0.50, @0.50, @0.00, @0.00, @0.00, @(RocksDBYCSBDistributionZipfian)],
+		@"b": @[@0.95, @0.05, @0.00, @0.00, @0.00, @(RocksDBYCSBDistributionZipfian)],
+		@"c": @[@1.00, @0.00, @0.00, @0.00, @0.00, @(RocksDBYCSBDistributionZipfian)],
+		@"d": @[@0.95, @0.00, @0.05, @0.00, @0.00, @(RocksDBYCSBDistributionLatest)],
+		@"e": @[@0.00, @0.00, @0.05, @0.95, @0.00, @(RocksDBYCSBDistributionZipfian)],
+		@"f": @[@0.50, @0.00, @0.00, @0.00, @0.50, @(RocksDBYCSBDistributionZipfian)]
+	};
+
+	NSArray<NSNumber *> *values = workloads[name.lowercaseString];
+	if (values == nil) {
+		return NO;
+	}
+	for (NSUInteger i = 0; i < RocksDBYCSBOperationCount; i++) {
+		workload->proportions[i] = values[i].doubleValue;
+	}
+	workload->distribution = (RocksDBYCSBDistribution)values[RocksDBYCSBOperationCount].unsignedIntegerValue;
+	return YES;
+}
+
+static NSData *KeyForRecord(uint64_t record)
+{
+	// YCSB hashes the record numbers, so that inserts aren't sequential
+	char buffer[32];
+	int length = snprintf(buffer, sizeof(buffer), "user%llu", (unsigned long long)FNVHash64(record));
+	return [NSData dataWithBytes:buffer length:length];
+}
+
+static uint64_t NowNanos()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void PrintHistogram(const char *operation, RocksDBBenchmarkHistogram *histogram, BOOL printBuckets)
+{
+	if (histogram.count == 0) {
+		return;
+	}
+
+	printf("[%s], Operations, %llu\n", operation, (unsigned long long)histogram.count);
+	printf("[%s], AverageLatency(us), %.3f\n", operation, histogram.average / 1e3);
+	printf("[%s], MinLatency(us), %.3f\n", operation, histogram.min / 1e3);
+	printf("[%s], MaxLatency(us), %.3f\n", operation, histogram.max / 1e3);
+	printf("[%s], 50thPercentileLatency(us), %.3f\n", operation, [histogram percentile:50] / 1e3);
+	printf("[%s], 95thPercentileLatency(us), %.3f\n", operation, [histogram percentile:95] / 1e3);
+	printf("[%s], 99thPercentileLatency(us), %.3f\n", operation, [histogram percentile:99] / 1e3);
+	printf("[%s], 99.9thPercentileLatency(us), %.3f\n", operation, [histogram percentile:99.9] / 1e3);
+
+	if (printBuckets) {
+		// Power of two microsecond buckets, the fine-grained ones are too many to be readable
+		__block std::vector<uint64_t> counts(64, 0);
+		[histogram enumerateBucketsUsingBlock:^(uint64_t lower, uint64_t upper, uint64_t count) {
+			uint64_t micros = lower / 1000;
+			counts[micros == 0 ? 0 : 64 - __builtin_clzll(micros)] += count;
+		}];
+		for (size_t i = 0; i < counts.size(); i++) {
+			if (counts[i] > 0) {
+				printf("[%s], < %llu us, %llu\n", operation, 1ULL << i, (unsigned long long)counts[i]);
+			}
+		}
+	}
+}
+
+#pragma mark - Benchmark
+
+int RocksDBRunYCSBBenchmark(RocksDBBenchmarkFlags *flags)
+{
+	NSString *workloadName = RocksDBBenchmarkFlagString(flags, @"workload", @"a");
+	RocksDBYCSBWorkload workload;
+	if (!WorkloadNamed(workloadName, &workload)) {
+		fprintf(stderr, "Unknown workload '%s', expected one of a-f\n", workloadName.UTF8String);
+		return 1;
+	}
+
+	// The proportions and the distribution of the workload may be overridden
+	NSArray<NSString *> *proportionFlags = @[@"readproportion", @"updateproportion", @"insertproportion", @"scanproportion", @"readmodifywriteproportion"];
+	for (NSUInteger i = 0; i < RocksDBYCSBOperationCount; i++) {
+		workload.proportions[i] = RocksDBBenchmarkFlagDouble(flags, proportionFlags[i], workload.proportions[i]);
+	}
+	NSString *distribution = flags[@"requestdistribution"];
+	if ([distribution isEqualToString:@"uniform"]) {
+		workload.distribution = RocksDBYCSBDistributionUniform;
+	} else if ([distribution isEqualToString:@"zipfian"]) {
+		workload.distribution = RocksDBYCSBDistributionZipfian;
+	} else if ([distribution isEqualToString:@"latest"]) {
+		workload.distribution = RocksDBYCSBDistributionLatest;
+	}
+
+	double totalProportion = 0;
+	for (NSUInteger i = 0; i < RocksDBYCSBOperationCount; i++) {
+		totalProportion += workload.proportions[i];
+	}
+	if (totalProportion <= 0) {
+		fprintf(stderr, "The operation proportions must not all be zero\n");
+		return 1;
+	}
+
+	uint64_t recordCount = MAX(RocksDBBenchmarkFlagUInt64(flags, @"recordcount", 100000), (uint64_t)1);
+	uint64_t operationCount = RocksDBBenchmarkFlagUInt64(flags, @"operationcount", 100000);
+	int threadCount = (int)MAX(RocksDBBenchmarkFlagUInt64(flags, @"threads", 1), (uint64_t)1);
+	size_t valueSize = (size_t)(RocksDBBenchmarkFlagUInt64(flags, @"fieldcount", 10) * RocksDBBenchmarkFlagUInt64(flags, @"fieldlength", 100));
+	uint64_t maxScanLength = MAX(RocksDBBenchmarkFlagUInt64(flags, @"maxscanlength", 100), (uint64_t)1);
+	uint64_t seed = RocksDBBenchmarkFlagUInt64(flags, @"seed", 301);
+	BOOL printBuckets = RocksDBBenchmarkFlagUInt64(flags, @"histogram", 0) != 0;
+
+	NSString *directory = RocksDBBenchmarkFlagString(flags, @"db", [NSTemporaryDirectory() stringByAppendingPathComponent:@"ObjectiveRocksBenchmarks"]);
+	NSString *path = [RocksDBBenchmark databasePathWithName:@"ycsb" inDirectory:directory];
+
+	RocksDBOptions *options = [RocksDBOptions new];
+	options.createIfMissing = YES;
+
+	NSError *error = nil;
+	RocksDB *db = [RocksDB databaseAtPath:path andOptions:options error:&error];
+	if (db == nil) {
+		fprintf(stderr, "Failed to open %s: %s\n", path.UTF8String, error.localizedDescription.UTF8String);
+		return 1;
+	}
+
+	RocksDBReadOptions *readOptions = [RocksDBReadOptions new];
+	RocksDBWriteOptions *writeOptions = [RocksDBWriteOptions new];
+	NSData *valueBuffer = [RocksDBBenchmark valueOfSize:MAX(valueSize, (size_t)1) * 2 seed:seed];
+
+	auto valueForRandom = [&](std::mt19937_64 &random) -> NSData * {
+		size_t offset = random() % (valueBuffer.length - valueSize + 1);
+		return [NSData dataWithBytesNoCopy:(uint8_t *)valueBuffer.bytes + offset length:valueSize freeWhenDone:NO];
+	};
+
+	// Load
+
+	uint64_t loadStart = NowNanos();
+	std::vector<std::thread> loaders;
+	for (int t = 0; t < threadCount; t++) {
+		loaders.emplace_back([&, t]() {
+			std::mt19937_64 random(seed + t);
+			for (uint64_t record = t; record < recordCount; record += threadCount) {
+				@autoreleasepool {
+					[db setData:valueForRandom(random) forKey:KeyForRecord(record) writeOptions:writeOptions error:nil];
+				}
+			}
+		});
+	}
+	for (auto &loader : loaders) {
+		loader.join();
+	}
+	double loadSeconds = (NowNanos() - loadStart) / 1e9;
+	printf("[LOAD], Records, %llu\n", (unsigned long long)recordCount);
+	printf("[LOAD], Throughput(ops/sec), %.1f\n", loadSeconds > 0 ? recordCount / loadSeconds : 0);
+
+	// Run
+
+	std::atomic<uint64_t> insertedCount(recordCount);
+	std::atomic<uint64_t> nextInsert(recordCount);
+	NSMutableArray<NSArray<RocksDBBenchmarkHistogram *> *> *threadHistograms = [NSMutableArray array];
+	for (int t = 0; t < threadCount; t++) {
+		NSMutableArray<RocksDBBenchmarkHistogram *> *histograms = [NSMutableArray array];
+		for (NSUInteger i = 0; i < RocksDBYCSBOperationCount; i++) {
+			[histograms addObject:[RocksDBBenchmarkHistogram new]];
+		}
+		[threadHistograms addObject:histograms];
+	}
+
+	uint64_t runStart = NowNanos();
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threadCount; t++) {
+		NSArray<RocksDBBenchmarkHistogram *> *histograms = threadHistograms[t];
+		uint64_t operations = operationCount / threadCount + ((uint64_t)t < operationCount % threadCount ? 1 : 0);
+		workers.emplace_back([&, t, histograms, operations]() {
+			std::mt19937_64 random(seed * 31 + t);
+			std::uniform_real_distribution<double> chooser(0, totalProportion);
+			RocksDBYCSBKeyChooser keys(workload.distribution, recordCount, random);
+
+			for (uint64_t i = 0; i < operations; i++) {
+				@autoreleasepool {
+					double choice = chooser(random);
+					NSUInteger operation = 0;
+					while (operation + 1 < RocksDBYCSBOperationCount && choice >= workload.proportions[operation]) {
+						choice -= workload.proportions[operation];
+						operation++;
+					}
+
+					uint64_t start = NowNanos();
+					switch ((RocksDBYCSBOperation)operation) {
+						case RocksDBYCSBOperationRead: {
+							[db dataForKey:KeyForRecord(keys.Next(insertedCount.load())) readOptions:readOptions error:nil];
+							break;
+						}
+						case RocksDBYCSBOperationUpdate: {
+							[db setData:valueForRandom(random) forKey:KeyForRecord(keys.Next(insertedCount.load())) writeOptions:writeOptions error:nil];
+							break;
+						}
+						case RocksDBYCSBOperationInsert: {
+							uint64_t record = nextInsert.fetch_add(1);
+							[db setData:valueForRandom(random) forKey:KeyForRecord(record) writeOptions:writeOptions error:nil];
+							// Acknowledges the inserts in order, like YCSB's acknowledged counter, so that the
+							// requests only choose records whose insert has completed
+							uint64_t expected = record;
+							while (!insertedCount.compare_exchange_weak(expected, record + 1) && expected <= record) {
+								expected = record;
+							}
+							break;
+						}
+						case RocksDBYCSBOperationScan: {
+							uint64_t length = 1 + random() % maxScanLength;
+							RocksDBIterator *iterator = [db iteratorWithReadOptions:readOptions];
+							[iterator seekToKey:KeyForRecord(keys.Next(insertedCount.load()))];
+							for (uint64_t n = 0; n < length && iterator.isValid; n++) {
+								[iterator key];
+								[iterator value];
+								[iterator next];
+							}
+							[iterator close];
+							break;
+						}
+						case RocksDBYCSBOperationReadModifyWrite: {
+							NSData *key = KeyForRecord(keys.Next(insertedCount.load()));
+							RocksDBIndexedWriteBatch *batch = [[RocksDBIndexedWriteBatch alloc] init:YES];
+							[batch getFromBatchAndDB:db options:readOptions key:key error:nil];
+							[batch setData:valueForRandom(random) forKey:key error:nil];
+							[db applyWriteBatch:batch writeOptions:writeOptions error:nil];
+							break;
+						}
+						case RocksDBYCSBOperationCount:
+							break;
+					}
+					[histograms[operation] recordNanos:NowNanos() - start];
+				}
+			}
+		});
+	}
+	for (auto &worker : workers) {
+		worker.join();
+	}
+	double runSeconds = (NowNanos() - runStart) / 1e9;
+
+	printf("[OVERALL], Workload, %s\n", workloadName.lowercaseString.UTF8String);
+	printf("[OVERALL], RunTime(ms), %.0f\n", runSeconds * 1e3);
+	printf("[OVERALL], Throughput(ops/sec), %.1f\n", runSeconds > 0 ? operationCount / runSeconds : 0);
+	for (NSUInteger i = 0; i < RocksDBYCSBOperationCount; i++) {
+		RocksDBBenchmarkHistogram *histogram = [RocksDBBenchmarkHistogram new];
+		for (NSArray<RocksDBBenchmarkHistogram *> *histograms in threadHistograms) {
+			[histogram mergeHistogram:histograms[i]];
+		}
+		PrintHistogram(RocksDBYCSBOperationNames[i], histogram, printBuckets);
+	}
+
+	[db close];
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+	return 0;
+}
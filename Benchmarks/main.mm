@@ -0,0 +1,67 @@
+//
+//  main.mm
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+#import "RocksDBBenchmark.h"
+
+static void PrintUsage(void)
+{
+	fprintf(stderr,
+			"usage: ObjectiveRocksBenchmarks <suite> [--flag=value ...]\n"
+			"\n"
+			"suites:\n"
+			"  overhead   ObjectiveRocks API versus rocksdb::DB (--num, --value_size, --batch_size, --db)\n"
+			"  dbbench    db_bench-style workloads through the ObjectiveRocks API\n"
+			"             --benchmarks=fillseq,fillrandom,overwrite,readrandom,readwhilewriting,seekrandom,mergerandom,deleterandom\n"
+			"             --num --reads --threads --key_size --value_size --value_size_distribution=fixed|uniform|normal\n"
+			"             --value_size_min --value_size_max --seek_nexts --reuse_iterator --seed --db --use_existing_db\n"
+			"             --write_buffer_size --max_write_buffer_number --target_file_size_base --max_bytes_for_level_base\n"
+			"             --level0_file_num_compaction_trigger --level0_slowdown_writes_trigger --level0_stop_writes_trigger\n"
+			"             --compression_type --cache_size --block_size --bloom_bits --cache_index_and_filter_blocks\n"
+			"             --max_background_compactions --max_background_flushes --open_files --disable_auto_compactions\n"
+			"             --sync --disable_wal --verify_checksum --statistics\n"
+			"  ycsb       YCSB core workloads through the ObjectiveRocks API\n"
+			"             --workload=a|b|c|d|e|f --recordcount --operationcount --threads --fieldcount --fieldlength\n"
+			"             --requestdistribution=uniform|zipfian|latest --readproportion --updateproportion --insertproportion\n"
+			"             --scanproportion --readmodifywriteproportion --maxscanlength --histogram --seed --db\n");
+}
+
+int main(int argc, const char * argv[])
+{
+	@autoreleasepool {
+		if (argc < 2) {
+			PrintUsage();
+			return 1;
+		}
+
+		NSString *suite = @(argv[1]);
+		NSMutableDictionary<NSString *, NSString *> *flags = [NSMutableDictionary dictionary];
+		for (int i = 2; i < argc; i++) {
+			NSString *argument = @(argv[i]);
+			if (![argument hasPrefix:@"--"]) {
+				PrintUsage();
+				return 1;
+			}
+			NSRange separator = [argument rangeOfString:@"="];
+			if (separator.location == NSNotFound) {
+				flags[[argument substringFromIndex:2]] = @"1";
+			} else {
+				NSString *name = [argument substringWithRange:NSMakeRange(2, separator.location - 2)];
+				flags[name] = [argument substringFromIndex:separator.location + 1];
+			}
+		}
+
+		if ([suite isEqualToString:@"overhead"]) {
+			return RocksDBRunOverheadBenchmark(flags);
+		} else if ([suite isEqualToString:@"dbbench"]) {
+			return RocksDBRunDBBenchmark(flags);
+		} else if ([suite isEqualToString:@"ycsb"]) {
+			return RocksDBRunYCSBBenchmark(flags);
+		}
+
+		PrintUsage();
+		return 1;
+	}
+}
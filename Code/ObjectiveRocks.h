@@ -25,6 +25,7 @@ extern const unsigned char ObjectiveRocksVersionString[];
 // Iterator
 #import "RocksDBIterator.h"
 #import "RocksDBPrefixExtractor.h"
+#import "RocksDBTupleKey.h"
 
 // Write Batch
 #import "RocksDBWriteBatch.h"
@@ -38,9 +39,11 @@ extern const unsigned char ObjectiveRocksVersionString[];
 #import "RocksDBOptions.h"
 #import "RocksDBDatabaseOptions.h"
 #import "RocksDBColumnFamilyOptions.h"
+#import "RocksDBCompressionOptions.h"
 #import "RocksDBWriteOptions.h"
 #import "RocksDBReadOptions.h"
 #import "RocksDBCompactRangeOptions.h"
+#import "RocksDBSizeApproximationOptions.h"
 
 // Env
 #import "RocksDBEnv.h"
@@ -53,6 +56,8 @@ extern const unsigned char ObjectiveRocksVersionString[];
 
 // Memtable
 #import "RocksDBMemTableRepFactory.h"
+#import "RocksDBWriteBufferManager.h"
+#import "RocksDBMemTableStats.h"
 
 // Snapshot
 #import "RocksDBSnapshot.h"
@@ -60,6 +65,9 @@ extern const unsigned char ObjectiveRocksVersionString[];
 // Merge Operator
 #import "RocksDBMergeOperator.h"
 
+// Statistics
+#import "RocksDBPerfContext.h"
+
 #if !defined(ROCKSDB_LITE)
 
 // Column Family
@@ -69,13 +77,18 @@ extern const unsigned char ObjectiveRocksVersionString[];
 #import "RocksDBIndexedWriteBatch.h"
 #import "RocksDBIndexedWriteBatch+getFromBatchAndDB.h"
 #import "RocksDBWriteBatchIterator.h"
+#import "RocksDBWriteStall.h"
 
 // Env
 #import "RocksDBThreadStatus.h"
+#import "RocksDBOperationMonitor.h"
 
 // Table
 #import "RocksDBPlainTableOptions.h"
 #import "RocksDBCuckooTableOptions.h"
+#import "RocksDBTableProperties.h"
+#import "RocksDBTablePropertiesCollectorFactory.h"
+#import "RocksDBCachePrewarmer.h"
 
 // Snapshot
 #import "RocksDBCheckpoint.h"
@@ -83,9 +96,19 @@ extern const unsigned char ObjectiveRocksVersionString[];
 // Statistics
 #import "RocksDBStatistics.h"
 #import "RocksDBStatisticsHistogram.h"
+#import "RocksDBStatisticsSnapshot.h"
+#import "RocksDBStatsHistory.h"
+#import "RocksDBMemoryUsage.h"
+#import "RocksDBMetricsExporter.h"
+#import "RocksDBInvocationStatistics.h"
+#import "RocksDBProperties.h"
 
 // Backup
 #import "RocksDBBackupEngine.h"
 #import "RocksDBBackupInfo.h"
 
+// Trace
+#import "RocksDBTrace.h"
+#import "RocksDBBlockCacheTrace.h"
+
 #endif
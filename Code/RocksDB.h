@@ -15,6 +15,8 @@
 #import "RocksDBReadOptions.h"
 #import "RocksDBWriteOptions.h"
 #import "RocksDBCompactRangeOptions.h"
+#import "RocksDBSizeApproximationOptions.h"
+#import "RocksDBMemTableStats.h"
 
 #import "RocksDBWriteBatch.h"
 #import "RocksDBIterator.h"
@@ -22,6 +24,12 @@
 #if !defined(ROCKSDB_LITE)
 #import "RocksDBColumnFamilyMetadata.h"
 #import "RocksDBIndexedWriteBatch.h"
+#import "RocksDBTableProperties.h"
+#import "RocksDBStatsHistory.h"
+#import "RocksDBTrace.h"
+#import "RocksDBBlockCacheTrace.h"
+#import "RocksDBWriteStall.h"
+#import "RocksDBProperties.h"
 #endif
 
 NS_ASSUME_NONNULL_BEGIN
@@ -370,6 +378,277 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSDictionary<NSString *, NSString *> *)valueForMapProperty:(NSString *)property
 				 inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily;
 
+/**
+ Returns the integer value for the given int property name aggregated over all column families.
+
+ @discussion Only properties whose values can be summed up are supported, e.g. the memtable sizes
+ or `RocksDBIntPropertyEstimateNumKeys`.
+
+ @param property The property name.
+ @return The aggregated integer value of the property, or 0 if it cannot be aggregated.
+
+ @warning Not available in RocksDB Lite.
+ */
+- (uint64_t)aggregatedValueForIntProperty:(NSString *)property;
+
+/**
+ Returns the values of the given int properties for each of the given column families in one table.
+
+ @param properties The property names, e.g. `RocksDBIntPropertyNumRunningCompactions`.
+ @param columnFamilies The column families to read from.
+ @return A table with one row per property and one column per column family.
+
+ @see RocksDBIntPropertyTable
+
+ @warning Not available in RocksDB Lite.
+ */
+- (RocksDBIntPropertyTable *)valuesForIntProperties:(NSArray<RocksDBIntPropertyName> *)properties
+								   inColumnFamilies:(NSArray<RocksDBColumnFamilyHandle *> *)columnFamilies;
+
+/**
+ Returns the values of the given int properties for each of the given column families in one table,
+ optionally together with their values aggregated over all column families.
+
+ @discussion Aggregating reads each property from every column family of the DB once more, which
+ roughly doubles the cost of the call.
+
+ @param properties The property names, e.g. `RocksDBIntPropertyNumRunningCompactions`.
+ @param columnFamilies The column families to read from.
+ @param aggregated Whether to also read the values aggregated over all column families.
+ @return A table with one row per property and one column per column family.
+
+ @see RocksDBIntPropertyTable
+
+ @warning Not available in RocksDB Lite.
+ */
+- (RocksDBIntPropertyTable *)valuesForIntProperties:(NSArray<RocksDBIntPropertyName> *)properties
+								   inColumnFamilies:(NSArray<RocksDBColumnFamilyHandle *> *)columnFamilies
+										 aggregated:(BOOL)aggregated;
+
+@end
+
+#endif
+
+#if !defined(ROCKSDB_LITE)
+
+#pragma mark - Write stalls
+
+@interface RocksDB (WriteStall)
+
+///--------------------------------
+/// @name Write stalls
+///--------------------------------
+
+/**
+ Returns the current write stall state of the DB.
+
+ @discussion The stall triggers are checked for the column families the DB was opened with.
+
+ @return The write stall state.
+
+ @see RocksDBWriteStallState
+
+ @warning Not available in RocksDB Lite.
+ */
+- (RocksDBWriteStallState *)writeStallState;
+
+/**
+ If non-nil, writes with `lowPriority` set in their write options are shed or deferred by this
+ admission control while the DB is close to a write stall. The default is nil.
+
+ @see RocksDBWriteAdmissionControl
+
+ @warning Not available in RocksDB Lite.
+ */
+@property (nonatomic, strong, nullable) RocksDBWriteAdmissionControl *writeAdmissionControl;
+
+@end
+
+#endif
+
+#if !defined(ROCKSDB_LITE)
+
+#pragma mark - Table properties
+
+@interface RocksDB (TableProperties)
+
+///--------------------------------
+/// @name Table properties
+///--------------------------------
+
+/**
+ Returns the properties of all live SST files in the default Column Family.
+
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return A dictionary mapping the SST file paths to their properties, nil on error.
+
+ @see RocksDBTableProperties
+
+ @warning Not available in RocksDB Lite.
+ */
+- (nullable NSDictionary<NSString *, RocksDBTableProperties *> *)propertiesOfAllTables:(NSError * __autoreleasing *)error;
+
+/**
+ Returns the properties of all live SST files in the given Column Family.
+
+ @param columnFamily The Column Family to read from.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return A dictionary mapping the SST file paths to their properties, nil on error.
+
+ @see RocksDBTableProperties
+
+ @warning Not available in RocksDB Lite.
+ */
+- (nullable NSDictionary<NSString *, RocksDBTableProperties *> *)propertiesOfAllTablesInColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+																							  error:(NSError * __autoreleasing *)error;
+
+/**
+ Returns the properties of the SST files in the default Column Family that overlap any of the
+ given key ranges. Files that do not overlap can be skipped by the caller entirely.
+
+ @discussion The end key of each range is exclusive. A range with a nil end key is open-ended
+ and conservatively yields the properties of all SST files.
+
+ @param ranges The key ranges.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return A dictionary mapping the SST file paths to their properties, nil on error.
+
+ @see RocksDBKeyRange
+ @see RocksDBTableProperties
+
+ @warning Not available in RocksDB Lite.
+ */
+- (nullable NSDictionary<NSString *, RocksDBTableProperties *> *)propertiesOfTablesInRanges:(NSArray<RocksDBKeyRange *> *)ranges
+																					 error:(NSError * __autoreleasing *)error;
+
+/**
+ Returns the properties of the SST files in the given Column Family that overlap any of the
+ given key ranges. Files that do not overlap can be skipped by the caller entirely.
+
+ @discussion The end key of each range is exclusive. A range with a nil end key is open-ended
+ and conservatively yields the properties of all SST files.
+
+ @param ranges The key ranges.
+ @param columnFamily The Column Family to read from.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return A dictionary mapping the SST file paths to their properties, nil on error.
+
+ @see RocksDBKeyRange
+ @see RocksDBTableProperties
+
+ @warning Not available in RocksDB Lite.
+ */
+- (nullable NSDictionary<NSString *, RocksDBTableProperties *> *)propertiesOfTablesInRanges:(NSArray<RocksDBKeyRange *> *)ranges
+																			inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+																					 error:(NSError * __autoreleasing *)error;
+
+@end
+
+#endif
+
+#if !defined(ROCKSDB_LITE)
+
+#pragma mark - Stats history
+
+@interface RocksDB (StatsHistory)
+
+///--------------------------------
+/// @name Stats history
+///--------------------------------
+
+/**
+ Returns the stats history of the DB in the given time window, ordered by time. The history is
+ recorded every `statsPersistPeriodSec` seconds when the DB has `statistics` set, and is kept
+ in memory up to `statsHistoryBufferSize` bytes, or in a hidden column family if
+ `persistStatsToDisk` is set.
+
+ @param startDate The start of the window, inclusive.
+ @param endDate The end of the window, exclusive.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The entries of the stats history, nil on error.
+
+ @see RocksDBStatsHistoryEntry
+
+ @warning Not available in RocksDB Lite.
+ */
+- (nullable NSArray<RocksDBStatsHistoryEntry *> *)statsHistoryFrom:(NSDate *)startDate
+																to:(NSDate *)endDate
+															 error:(NSError * __autoreleasing *)error;
+
+@end
+
+#endif
+
+#if !defined(ROCKSDB_LITE)
+
+#pragma mark - Tracing
+
+@interface RocksDB (Tracing)
+
+///--------------------------------
+/// @name Tracing
+///--------------------------------
+
+/**
+ Starts recording the operations executed on the DB into a trace file, which can be replayed
+ against another database with `RocksDBTraceReplayer`.
+
+ @param options The options of the trace.
+ @param path The path of the trace file.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return True if the trace was started.
+
+ @see RocksDBTraceOptions
+ @see RocksDBTraceReplayer
+
+ @warning Not available in RocksDB Lite.
+ */
+- (BOOL)startTraceWithOptions:(RocksDBTraceOptions *)options
+					   toPath:(NSString *)path
+						error:(NSError * __autoreleasing *)error;
+
+/**
+ Stops recording the trace started with `startTraceWithOptions:toPath:error:` and closes the
+ trace file.
+
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return True if the trace was stopped.
+
+ @warning Not available in RocksDB Lite.
+ */
+- (BOOL)endTrace:(NSError * __autoreleasing *)error;
+
+/**
+ Starts recording the block cache accesses of the DB into a trace file, which can be analyzed
+ with `RocksDBCacheSimulation`.
+
+ @discussion Only the `maxTraceFileSize` and `samplingFrequency` of the options apply to block
+ cache traces.
+
+ @param options The options of the trace.
+ @param path The path of the trace file.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return True if the trace was started.
+
+ @see RocksDBCacheSimulation
+
+ @warning Not available in RocksDB Lite.
+ */
+- (BOOL)startBlockCacheTraceWithOptions:(RocksDBTraceOptions *)options
+								 toPath:(NSString *)path
+								  error:(NSError * __autoreleasing *)error;
+
+/**
+ Stops recording the block cache trace started with `startBlockCacheTraceWithOptions:toPath:error:`
+ and closes the trace file.
+
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return True if the trace was stopped.
+
+ @warning Not available in RocksDB Lite.
+ */
+- (BOOL)endBlockCacheTrace:(NSError * __autoreleasing *)error;
+
 @end
 
 #endif
@@ -1043,6 +1322,106 @@ forColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
 
 @end
 
+#pragma mark - Approximate Sizes
+
+@interface RocksDB (ApproximateSizes)
+
+///--------------------------------
+/// @name Approximate Sizes
+///--------------------------------
+
+/**
+ Returns the approximate sizes in bytes of the given key ranges in the default Column Family.
+
+ The end key of each range is exclusive. A `nil` start key is treated as a key before all keys,
+ and a `nil` end key is resolved to a key right after the last key in the Column Family.
+ Open-ended ranges are only supported with the bytewise comparator, with any other comparator
+ they yield an invalid argument error.
+
+ @discussion The approximation is computed from the index blocks of the SST files and, if enabled
+ in the options, from the mem tables. It does not read any data blocks, which makes it far cheaper
+ than scanning the ranges.
+
+ @param ranges The key ranges.
+ @param options The options for the size approximation.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return An array with the approximate size of each range, in the order of the given ranges, nil on error.
+
+ @see RocksDBKeyRange
+ @see RocksDBSizeApproximationOptions
+ */
+- (nullable NSArray<NSNumber *> *)approximateSizesForRanges:(NSArray<RocksDBKeyRange *> *)ranges
+												withOptions:(RocksDBSizeApproximationOptions *)options
+													  error:(NSError * __autoreleasing *)error;
+
+/**
+ Returns the approximate sizes in bytes of the given key ranges in the given Column Family.
+
+ The end key of each range is exclusive. A `nil` start key is treated as a key before all keys,
+ and a `nil` end key is resolved to a key right after the last key in the Column Family.
+ Open-ended ranges are only supported with the bytewise comparator, with any other comparator
+ they yield an invalid argument error.
+
+ @discussion The approximation is computed from the index blocks of the SST files and, if enabled
+ in the options, from the mem tables. It does not read any data blocks, which makes it far cheaper
+ than scanning the ranges.
+
+ @param ranges The key ranges.
+ @param options The options for the size approximation.
+ @param columnFamily The Column Family to read from.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return An array with the approximate size of each range, in the order of the given ranges, nil on error.
+
+ @see RocksDBKeyRange
+ @see RocksDBSizeApproximationOptions
+ */
+- (nullable NSArray<NSNumber *> *)approximateSizesForRanges:(NSArray<RocksDBKeyRange *> *)ranges
+												withOptions:(RocksDBSizeApproximationOptions *)options
+											 inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+													  error:(NSError * __autoreleasing *)error;
+
+/**
+ Returns the approximate number of entries and their size in the mem tables of the default
+ Column Family for each of the given key ranges.
+
+ The end key of each range is exclusive. A `nil` start key is treated as a key before all keys,
+ and a `nil` end key is resolved to a key right after the last key in the Column Family.
+ Open-ended ranges are only supported with the bytewise comparator, with any other comparator
+ they yield an invalid argument error.
+
+ @param ranges The key ranges.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return An array with the mem table stats of each range, in the order of the given ranges, nil on error.
+
+ @see RocksDBKeyRange
+ @see RocksDBMemTableStats
+ */
+- (nullable NSArray<RocksDBMemTableStats *> *)approximateMemTableStatsForRanges:(NSArray<RocksDBKeyRange *> *)ranges
+																		  error:(NSError * __autoreleasing *)error;
+
+/**
+ Returns the approximate number of entries and their size in the mem tables of the given
+ Column Family for each of the given key ranges.
+
+ The end key of each range is exclusive. A `nil` start key is treated as a key before all keys,
+ and a `nil` end key is resolved to a key right after the last key in the Column Family.
+ Open-ended ranges are only supported with the bytewise comparator, with any other comparator
+ they yield an invalid argument error.
+
+ @param ranges The key ranges.
+ @param columnFamily The Column Family to read from.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return An array with the mem table stats of each range, in the order of the given ranges, nil on error.
+
+ @see RocksDBKeyRange
+ @see RocksDBMemTableStats
+ */
+- (nullable NSArray<RocksDBMemTableStats *> *)approximateMemTableStatsForRanges:(NSArray<RocksDBKeyRange *> *)ranges
+																 inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+																		  error:(NSError * __autoreleasing *)error;
+
+@end
+
 #pragma mark - File Deletions
 
 @interface RocksDB (FileDeletion)
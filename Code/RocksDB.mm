@@ -21,6 +21,8 @@
 #import "RocksDBWriteOptions.h"
 
 #import "RocksDBCompactRangeOptions+Private.h"
+#import "RocksDBSizeApproximationOptions+Private.h"
+#import "RocksDBMemTableStats+Private.h"
 
 #import "RocksDBIterator+Private.h"
 #import "RocksDBWriteBatch+Private.h"
@@ -35,13 +37,32 @@
 #include <rocksdb/db.h>
 #include <rocksdb/slice.h>
 #include <rocksdb/options.h>
+#include <rocksdb/comparator.h>
 
 #if !defined(ROCKSDB_LITE)
 #import "RocksDBColumnFamilyMetaData+Private.h"
+#import "RocksDBTableProperties+Private.h"
+#import <rocksdb/table_properties.h>
+#import <rocksdb/stats_history.h>
+#import <rocksdb/trace_reader_writer.h>
+#import "RocksDBWriteStall+Private.h"
+#import "RocksDBProperties+Private.h"
 #endif
 
 #pragma mark -
 
+#if !defined(ROCKSDB_LITE)
+@interface RocksDBStatsHistoryEntry ()
+- (instancetype)initWithTime:(uint64_t)time
+					interval:(NSTimeInterval)interval
+					 tickers:(const std::map<std::string, uint64_t> &)tickers;
+@end
+
+@interface RocksDBTraceOptions ()
+@property (nonatomic, assign) rocksdb::TraceOptions options;
+@end
+#endif
+
 @interface RocksDBColumnFamilyDescriptor (Private)
 @property (nonatomic, assign) std::vector<rocksdb::ColumnFamilyDescriptor> *columnFamilies;
 @end
@@ -58,6 +79,9 @@
 	RocksDBOptions *_options;
 	RocksDBReadOptions *_readOptions;
 	RocksDBWriteOptions *_writeOptions;
+#if !defined(ROCKSDB_LITE)
+	RocksDBWriteAdmissionControl *_writeAdmissionControl;
+#endif
 }
 @property (nonatomic, strong) NSString *path;
 @property (nonatomic, assign) rocksdb::DB *db;
@@ -353,7 +377,7 @@
 - (NSArray *)columnFamilies
 {
 	if (_columnFamilyHandles == nullptr) {
-		return [NSArray init];
+		return @[];
 	}
 
 	if (_columnFamilies == nil) {
@@ -414,9 +438,7 @@
 - (NSString *)valueForProperty:(NSString *)property inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
 {
 	std::string value;
-	bool ok = _db->GetProperty(columnFamily.columnFamily,
-							   SliceFromData([property dataUsingEncoding:NSUTF8StringEncoding]),
-							   &value);
+	bool ok = _db->GetProperty(columnFamily.columnFamily, property.UTF8String, &value);
 	if (!ok) {
 		return nil;
 	}
@@ -433,9 +455,7 @@
 - (uint64_t)valueForIntProperty:(NSString *)property inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
 {
 	uint64_t value;
-	bool ok = _db->GetIntProperty(columnFamily.columnFamily,
-								  SliceFromData([property dataUsingEncoding:NSUTF8StringEncoding]),
-								  &value);
+	bool ok = _db->GetIntProperty(columnFamily.columnFamily, property.UTF8String, &value);
 	if (!ok) {
 		return 0;
 	}
@@ -454,9 +474,7 @@
 
 	std::map<std::string, std::string> value;
 
-	bool ok = _db->GetMapProperty(_columnFamily.columnFamily,
-								  SliceFromData([property dataUsingEncoding:NSUTF8StringEncoding]),
-								  &value);
+	bool ok = _db->GetMapProperty(columnFamily.columnFamily, property.UTF8String, &value);
 	if (ok) {
 		for(auto const &entry : value) {
 			NSString* newKey = [NSString stringWithUTF8String:entry.first.c_str()];
@@ -467,6 +485,269 @@
 	return newDictionary;
 }
 
+- (uint64_t)aggregatedValueForIntProperty:(NSString *)property
+{
+	uint64_t value;
+	bool ok = _db->GetAggregatedIntProperty(property.UTF8String, &value);
+	if (!ok) {
+		return 0;
+	}
+	return value;
+}
+
+- (RocksDBIntPropertyTable *)valuesForIntProperties:(NSArray<RocksDBIntPropertyName> *)properties
+								   inColumnFamilies:(NSArray<RocksDBColumnFamilyHandle *> *)columnFamilies
+{
+	return [self valuesForIntProperties:properties inColumnFamilies:columnFamilies aggregated:NO];
+}
+
+- (RocksDBIntPropertyTable *)valuesForIntProperties:(NSArray<RocksDBIntPropertyName> *)properties
+								   inColumnFamilies:(NSArray<RocksDBColumnFamilyHandle *> *)columnFamilies
+										 aggregated:(BOOL)aggregated
+{
+	return [[RocksDBIntPropertyTable alloc] initWithDB:_db properties:properties columnFamilies:columnFamilies aggregated:aggregated];
+}
+
+#endif
+
+#if !defined(ROCKSDB_LITE)
+
+#pragma mark - Write Stalls
+
+- (RocksDBWriteStallState *)writeStallState
+{
+	std::vector<rocksdb::ColumnFamilyHandle *> columnFamilies;
+	if (_columnFamilyHandles != nullptr) {
+		columnFamilies = *_columnFamilyHandles;
+	} else {
+		columnFamilies.push_back(_db->DefaultColumnFamily());
+	}
+	return [[RocksDBWriteStallState alloc] initWithDB:_db columnFamilies:columnFamilies];
+}
+
+- (RocksDBWriteAdmissionControl *)writeAdmissionControl
+{
+	return _writeAdmissionControl;
+}
+
+- (void)setWriteAdmissionControl:(RocksDBWriteAdmissionControl *)writeAdmissionControl
+{
+	_writeAdmissionControl = writeAdmissionControl;
+}
+
+#endif
+
+- (BOOL)admitWrite:(RocksDBWriteOptions *)writeOptions error:(NSError * __autoreleasing *)error
+{
+#if !defined(ROCKSDB_LITE)
+	RocksDBWriteAdmissionControl *admissionControl = _writeAdmissionControl;
+	if (admissionControl == nil || !writeOptions.lowPriority) {
+		return YES;
+	}
+
+	__weak RocksDB *weakSelf = self;
+	BOOL admitted = [admissionControl admitLowPriorityWriteWithState:^RocksDBWriteStallState *{
+		return [weakSelf writeStallState];
+	}];
+
+	if (!admitted) {
+		rocksdb::Status status = rocksdb::Status::Incomplete("Low priority write rejected by admission control");
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return NO;
+	}
+#endif
+	return YES;
+}
+
+#if !defined(ROCKSDB_LITE)
+
+#pragma mark - Table Properties
+
+- (NSDictionary<NSString *, RocksDBTableProperties *> *)propertiesOfAllTables:(NSError * __autoreleasing *)error
+{
+	return [self propertiesOfAllTablesInColumnFamily:_columnFamily error:error];
+}
+
+- (NSDictionary<NSString *, RocksDBTableProperties *> *)propertiesOfAllTablesInColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+																					  error:(NSError * __autoreleasing *)error
+{
+	rocksdb::TablePropertiesCollection collection;
+	rocksdb::Status status = _db->GetPropertiesOfAllTables(columnFamily.columnFamily, &collection);
+
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+	return [self tablePropertiesFromCollection:collection];
+}
+
+- (NSDictionary<NSString *, RocksDBTableProperties *> *)propertiesOfTablesInRanges:(NSArray<RocksDBKeyRange *> *)ranges
+																			 error:(NSError * __autoreleasing *)error
+{
+	return [self propertiesOfTablesInRanges:ranges inColumnFamily:_columnFamily error:error];
+}
+
+- (NSDictionary<NSString *, RocksDBTableProperties *> *)propertiesOfTablesInRanges:(NSArray<RocksDBKeyRange *> *)ranges
+																	inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+																			 error:(NSError * __autoreleasing *)error
+{
+	std::vector<rocksdb::Range> nativeRanges;
+	for (RocksDBKeyRange *range in ranges) {
+		if (range.end == nil) {
+			return [self propertiesOfAllTablesInColumnFamily:columnFamily error:error];
+		}
+		nativeRanges.push_back(rocksdb::Range(SliceFromData(range.start), SliceFromData(range.end)));
+	}
+
+	rocksdb::TablePropertiesCollection collection;
+	rocksdb::Status status = _db->GetPropertiesOfTablesInRange(columnFamily.columnFamily,
+															   nativeRanges.data(),
+															   nativeRanges.size(),
+															   &collection);
+
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+	return [self tablePropertiesFromCollection:collection];
+}
+
+- (NSDictionary<NSString *, RocksDBTableProperties *> *)tablePropertiesFromCollection:(const rocksdb::TablePropertiesCollection &)collection
+{
+	NSMutableDictionary<NSString *, RocksDBTableProperties *> *result = [NSMutableDictionary dictionary];
+	for (auto const &entry : collection) {
+		NSString *path = [NSString stringWithUTF8String:entry.first.c_str()];
+		result[path] = [[RocksDBTableProperties alloc] initWithTableProperties:*entry.second];
+	}
+	return result;
+}
+
+#endif
+
+#if !defined(ROCKSDB_LITE)
+
+#pragma mark - Stats History
+
+- (NSArray<RocksDBStatsHistoryEntry *> *)statsHistoryFrom:(NSDate *)startDate
+													   to:(NSDate *)endDate
+													error:(NSError * __autoreleasing *)error
+{
+	std::unique_ptr<rocksdb::StatsHistoryIterator> iterator;
+	rocksdb::Status status = _db->GetStatsHistory((uint64_t)MAX(startDate.timeIntervalSince1970, 0),
+												  (uint64_t)MAX(endDate.timeIntervalSince1970, 0),
+												  &iterator);
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+
+	NSMutableArray<RocksDBStatsHistoryEntry *> *history = [NSMutableArray array];
+	uint64_t previousTime = 0;
+	for (; iterator->Valid(); iterator->Next()) {
+		uint64_t time = iterator->GetStatsTime();
+		NSTimeInterval interval = previousTime > 0 ? time - previousTime : _options.statsPersistPeriodSec;
+		[history addObject:[[RocksDBStatsHistoryEntry alloc] initWithTime:time
+																 interval:interval
+																  tickers:iterator->GetStatsMap()]];
+		previousTime = time;
+	}
+
+	status = iterator->status();
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+
+	return history;
+}
+
+#endif
+
+#if !defined(ROCKSDB_LITE)
+
+#pragma mark - Tracing
+
+- (BOOL)startTraceWithOptions:(RocksDBTraceOptions *)options
+					   toPath:(NSString *)path
+						error:(NSError * __autoreleasing *)error
+{
+	std::unique_ptr<rocksdb::TraceWriter> writer;
+	rocksdb::Status status = rocksdb::NewFileTraceWriter(_db->GetEnv(), rocksdb::EnvOptions(), path.UTF8String, &writer);
+	if (status.ok()) {
+		status = _db->StartTrace(options.options, std::move(writer));
+	}
+
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return NO;
+	}
+	return YES;
+}
+
+- (BOOL)endTrace:(NSError * __autoreleasing *)error
+{
+	rocksdb::Status status = _db->EndTrace();
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return NO;
+	}
+	return YES;
+}
+
+- (BOOL)startBlockCacheTraceWithOptions:(RocksDBTraceOptions *)options
+								 toPath:(NSString *)path
+								  error:(NSError * __autoreleasing *)error
+{
+	std::unique_ptr<rocksdb::TraceWriter> writer;
+	rocksdb::Status status = rocksdb::NewFileTraceWriter(_db->GetEnv(), rocksdb::EnvOptions(), path.UTF8String, &writer);
+	if (status.ok()) {
+		status = _db->StartBlockCacheTrace(options.options, std::move(writer));
+	}
+
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return NO;
+	}
+	return YES;
+}
+
+- (BOOL)endBlockCacheTrace:(NSError * __autoreleasing *)error
+{
+	rocksdb::Status status = _db->EndBlockCacheTrace();
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return NO;
+	}
+	return YES;
+}
+
 #endif
 
 #pragma mark - Write Operations
@@ -498,6 +779,10 @@ forColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
    writeOptions:(RocksDBWriteOptions *) writeOptions
 		  error:(NSError * __autoreleasing *)error
 {
+	if (![self admitWrite:writeOptions error:error]) {
+		return NO;
+	}
+
 	rocksdb::Status status = _db->Put(writeOptions.options,
 									  columnFamily.columnFamily,
 									  SliceFromData(aKey),
@@ -544,7 +829,11 @@ forColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
 	 writeOptions:(RocksDBWriteOptions *)writeOptions
 			error:(NSError * __autoreleasing *)error
 {
-	rocksdb::Status status = _db->Merge(_writeOptions.options,
+	if (![self admitWrite:writeOptions error:error]) {
+		return NO;
+	}
+
+	rocksdb::Status status = _db->Merge(writeOptions.options,
 										columnFamily.columnFamily,
 										SliceFromData(aKey),
 										SliceFromData(anObject));
@@ -716,6 +1005,10 @@ forColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
 			writeOptions:(RocksDBWriteOptions *)writeOptions
 				   error:(NSError * __autoreleasing *)error
 {
+	if (![self admitWrite:writeOptions error:error]) {
+		return NO;
+	}
+
 	rocksdb::Status status = _db->Delete(writeOptions.options,
 										 columnFamily.columnFamily,
 										 SliceFromData(aKey));
@@ -756,6 +1049,10 @@ forColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
 	 inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
 			  error:(NSError * _Nullable __autoreleasing *)error
 {
+	if (![self admitWrite:options error:error]) {
+		return NO;
+	}
+
 	rocksdb::Slice startSlice = SliceFromData(range.start);
 	rocksdb::Slice endSlice = SliceFromData(range.end);
 
@@ -776,6 +1073,10 @@ forColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
 		   writeOptions:(RocksDBWriteOptions *)writeOptions
 				  error:(NSError * __autoreleasing *)error
 {
+	if (![self admitWrite:writeOptions error:error]) {
+		return NO;
+	}
+
 	rocksdb::WriteBatch *batch = writeBatch.writeBatchBase->GetWriteBatch();
 	rocksdb::Status status = _db->Write(writeOptions.options, batch);
 
@@ -916,6 +1217,136 @@ forColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
 	return YES;
 }
 
+#pragma mark - Approximate Sizes
+
+- (NSArray<NSNumber *> *)approximateSizesForRanges:(NSArray<RocksDBKeyRange *> *)ranges
+									   withOptions:(RocksDBSizeApproximationOptions *)options
+											 error:(NSError * __autoreleasing *)error
+{
+	return [self approximateSizesForRanges:ranges withOptions:options inColumnFamily:_columnFamily error:error];
+}
+
+- (NSArray<NSNumber *> *)approximateSizesForRanges:(NSArray<RocksDBKeyRange *> *)ranges
+									   withOptions:(RocksDBSizeApproximationOptions *)options
+									inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+											 error:(NSError * __autoreleasing *)error
+{
+	std::string endKey;
+	std::vector<rocksdb::Range> nativeRanges;
+	rocksdb::Status status = [self nativeRanges:&nativeRanges fromRanges:ranges inColumnFamily:columnFamily endKey:&endKey];
+
+	std::vector<uint64_t> sizes(nativeRanges.size(), 0);
+	if (status.ok()) {
+		status = _db->GetApproximateSizes(options.options,
+										  columnFamily.columnFamily,
+										  nativeRanges.data(),
+										  (int)nativeRanges.size(),
+										  sizes.data());
+	}
+
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+
+	NSMutableArray<NSNumber *> *result = [NSMutableArray arrayWithCapacity:sizes.size()];
+	for (uint64_t size : sizes) {
+		[result addObject:@(size)];
+	}
+	return result;
+}
+
+- (NSArray<RocksDBMemTableStats *> *)approximateMemTableStatsForRanges:(NSArray<RocksDBKeyRange *> *)ranges
+																 error:(NSError * __autoreleasing *)error
+{
+	return [self approximateMemTableStatsForRanges:ranges inColumnFamily:_columnFamily error:error];
+}
+
+- (NSArray<RocksDBMemTableStats *> *)approximateMemTableStatsForRanges:(NSArray<RocksDBKeyRange *> *)ranges
+														inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+																 error:(NSError * __autoreleasing *)error
+{
+	std::string endKey;
+	std::vector<rocksdb::Range> nativeRanges;
+	rocksdb::Status status = [self nativeRanges:&nativeRanges fromRanges:ranges inColumnFamily:columnFamily endKey:&endKey];
+
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+
+	NSMutableArray<RocksDBMemTableStats *> *result = [NSMutableArray arrayWithCapacity:nativeRanges.size()];
+	for (const rocksdb::Range &range : nativeRanges) {
+		uint64_t count = 0;
+		uint64_t size = 0;
+		_db->GetApproximateMemTableStats(columnFamily.columnFamily, range, &count, &size);
+		[result addObject:[[RocksDBMemTableStats alloc] initWithCount:count size:size]];
+	}
+	return result;
+}
+
+/**
+ Converts the key ranges to native ranges. Open-ended ranges are closed with a key right after
+ the last key in the Column Family, which is stored in `endKey` and must outlive the result.
+ Open-ended ranges are only supported with the bytewise comparator, under which the empty key
+ sorts first and appending a byte to a key sorts right after it.
+ */
+- (rocksdb::Status)nativeRanges:(std::vector<rocksdb::Range> *)nativeRanges
+					 fromRanges:(NSArray<RocksDBKeyRange *> *)ranges
+				 inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+						 endKey:(std::string *)endKey
+{
+	BOOL resolvedEndKey = NO;
+	const rocksdb::Comparator *comparator = columnFamily.columnFamily->GetComparator();
+
+	nativeRanges->reserve(ranges.count);
+	for (RocksDBKeyRange *range in ranges) {
+		if (range.start != nil && range.end != nil) {
+			nativeRanges->push_back(rocksdb::Range(SliceFromData(range.start), SliceFromData(range.end)));
+			continue;
+		}
+
+		if (comparator != rocksdb::BytewiseComparator()) {
+			return rocksdb::Status::InvalidArgument("Open-ended ranges require the bytewise comparator", comparator->Name());
+		}
+
+		rocksdb::Slice start = SliceFromData(range.start);
+		if (range.end != nil) {
+			nativeRanges->push_back(rocksdb::Range(start, SliceFromData(range.end)));
+			continue;
+		}
+
+		if (!resolvedEndKey) {
+			rocksdb::ReadOptions readOptions;
+			readOptions.total_order_seek = true;
+			readOptions.fill_cache = false;
+			std::unique_ptr<rocksdb::Iterator> iterator(_db->NewIterator(readOptions, columnFamily.columnFamily));
+			iterator->SeekToLast();
+			if (!iterator->status().ok()) {
+				return iterator->status();
+			}
+			if (iterator->Valid()) {
+				*endKey = iterator->key().ToString();
+				endKey->push_back('\0');
+			}
+			resolvedEndKey = YES;
+		}
+		// Ranges starting after the last key, or in an empty Column Family, are empty
+		if (endKey->empty() || comparator->Compare(start, *endKey) > 0) {
+			nativeRanges->push_back(rocksdb::Range(start, start));
+		} else {
+			nativeRanges->push_back(rocksdb::Range(start, *endKey));
+		}
+	}
+	return rocksdb::Status::OK();
+}
+
 #pragma mark - File Deletions
 
 #if !defined(ROCKSDB_LITE)
@@ -36,6 +36,21 @@ typedef NS_ENUM(char, BlockBasedTableChecksumType) {
 	BlockBasedTableChecksumxxHash = 0x2,
 };
 
+typedef NS_ENUM(char, BlockBasedTableDataBlockIndexType)
+{
+	/**
+	 @brief Traditional block type: a point lookup binary-searches the
+	 restart points of each data block.
+	 */
+	BlockBasedTableDataBlockBinarySearch = 0x0,
+
+	/**
+	 @brief Additional hash index appended to each data block, which
+	 turns most point lookups within a block into a single hash probe.
+	 */
+	BlockBasedTableDataBlockBinaryAndHash = 0x1
+};
+
 @interface RocksDBBlockBasedTableOptions : NSObject
 
 /**
@@ -119,6 +134,25 @@ typedef NS_ENUM(char, BlockBasedTableChecksumType) {
  */
 @property (nonatomic, assign) int blockRestartInterval;
 
+/**
+ @brief
+  The index type used within each data block. The hash index speeds up
+  point lookups at the cost of a little extra space per block; range
+  scans are not affected. Default is BlockBasedTableDataBlockBinarySearch.
+
+ @see dataBlockHashTableUtilRatio
+ */
+@property (nonatomic, assign) BlockBasedTableDataBlockIndexType dataBlockIndexType;
+
+/**
+ @brief
+  The desired utilization of the data block hash index, i.e. the number
+  of entries divided by the number of buckets. A lower ratio means fewer
+  hash collisions and a larger index. Only used with
+  BlockBasedTableDataBlockBinaryAndHash. Default is 0.75.
+ */
+@property (nonatomic, assign) double dataBlockHashTableUtilRatio;
+
 /**
  @brief
   Use the specified filter policy to reduce disk reads.
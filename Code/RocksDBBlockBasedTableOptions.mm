@@ -139,6 +139,26 @@
 	return _options.block_restart_interval;
 }
 
+- (void)setDataBlockIndexType:(BlockBasedTableDataBlockIndexType)dataBlockIndexType
+{
+	_options.data_block_index_type = (rocksdb::BlockBasedTableOptions::DataBlockIndexType)dataBlockIndexType;
+}
+
+- (BlockBasedTableDataBlockIndexType)dataBlockIndexType
+{
+	return (BlockBasedTableDataBlockIndexType)_options.data_block_index_type;
+}
+
+- (void)setDataBlockHashTableUtilRatio:(double)dataBlockHashTableUtilRatio
+{
+	_options.data_block_hash_table_util_ratio = dataBlockHashTableUtilRatio;
+}
+
+- (double)dataBlockHashTableUtilRatio
+{
+	return _options.data_block_hash_table_util_ratio;
+}
+
 - (void)setFilterPolicy:(RocksDBFilterPolicy *)filterPolicy
 {
 	_filterPolicyWrapper = filterPolicy;
@@ -0,0 +1,95 @@
+//
+//  RocksDBBlockCacheTrace.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** @brief The eviction policies of the simulated caches. */
+typedef NS_ENUM(NSUInteger, RocksDBCacheSimulationPolicy)
+{
+	/** @brief A plain LRU cache. */
+	RocksDBCacheSimulationPolicyLRU,
+	/** @brief An LRU cache with a high priority pool for index and filter blocks. */
+	RocksDBCacheSimulationPolicyLRUPriority,
+	/** @brief An LRU cache that caches both rows, as the row cache does, and blocks. */
+	RocksDBCacheSimulationPolicyLRUHybrid
+};
+
+/**
+ A point of a miss-ratio curve: the miss ratio a cache of the given capacity and policy would
+ have had for the traced block cache accesses.
+
+ @see RocksDBCacheSimulation
+ */
+@interface RocksDBMissRatioPoint : NSObject
+
+/** @brief The eviction policy of the simulated cache. */
+@property (nonatomic, readonly) RocksDBCacheSimulationPolicy policy;
+
+/** @brief The capacity of the simulated cache in bytes. */
+@property (nonatomic, readonly) uint64_t capacity;
+
+/** @brief The number of simulated accesses, excluding the warmup period. */
+@property (nonatomic, readonly) uint64_t accesses;
+
+/** @brief The number of simulated misses, excluding the warmup period. */
+@property (nonatomic, readonly) uint64_t misses;
+
+/** @brief The miss ratio between 0 and 1. */
+@property (nonatomic, readonly) double missRatio;
+
+@end
+
+/**
+ Replays a block cache trace, captured with `-[RocksDB startBlockCacheTraceWithOptions:toPath:error:]`,
+ through simulated caches of several capacities and policies, in order to compute the
+ miss-ratio curve of the traced workload.
+ */
+@interface RocksDBCacheSimulation : NSObject
+
+/**
+ Initializes a new simulation.
+
+ @param capacities The capacities of the simulated caches in bytes.
+ @param policies The `RocksDBCacheSimulationPolicy` values of the simulated caches. Each
+ policy is simulated with each capacity.
+ @return A newly-initialized simulation.
+ */
+- (instancetype)initWithCapacities:(NSArray<NSNumber *> *)capacities
+						  policies:(NSArray<NSNumber *> *)policies;
+
+/** @brief The number of shard bits of the simulated caches.
+ The default is 6. */
+@property (nonatomic, assign) uint32_t numShardBits;
+
+/** @brief The accesses of the first warmupSeconds of the trace fill the simulated caches
+ but aren't counted.
+ The default is 0. */
+@property (nonatomic, assign) uint64_t warmupSeconds;
+
+/** @brief If the trace was sampled, e.g. with a `samplingFrequency` of 10, the same ratio
+ must be given here to scale down the simulated capacities accordingly.
+ The default is 1. */
+@property (nonatomic, assign) uint32_t downsampleRatio;
+
+/** @brief If not zero, each simulated cache admits a block only on its second access
+ within a ghost cache of this capacity.
+ The default is 0. */
+@property (nonatomic, assign) uint64_t ghostCacheCapacity;
+
+/**
+ Runs the simulation for the given trace.
+
+ @param path The path of the block cache trace file.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The miss-ratio curve, ordered by policy and capacity, nil on error.
+ */
+- (nullable NSArray<RocksDBMissRatioPoint *> *)simulateTraceAtPath:(NSString *)path
+															 error:(NSError * _Nullable *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
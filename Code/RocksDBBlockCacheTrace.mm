@@ -0,0 +1,145 @@
+//
+//  RocksDBBlockCacheTrace.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBBlockCacheTrace.h"
+#import "RocksDBError.h"
+
+#import <rocksdb/env.h>
+#import <rocksdb/trace_reader_writer.h>
+#import <trace_replay/block_cache_tracer.h>
+#import <utilities/simulator_cache/cache_simulator.h>
+
+static std::string CacheName(RocksDBCacheSimulationPolicy policy, bool ghost)
+{
+	std::string name;
+	switch (policy) {
+		case RocksDBCacheSimulationPolicyLRU:
+			name = "lru";
+			break;
+		case RocksDBCacheSimulationPolicyLRUPriority:
+			name = "lru_priority";
+			break;
+		case RocksDBCacheSimulationPolicyLRUHybrid:
+			name = "lru_hybrid";
+			break;
+	}
+	return ghost ? "ghost_" + name : name;
+}
+
+#pragma mark - Miss Ratio
+
+@implementation RocksDBMissRatioPoint
+
+- (instancetype)initWithPolicy:(RocksDBCacheSimulationPolicy)policy
+					  capacity:(uint64_t)capacity
+						 stats:(const rocksdb::MissRatioStats &)stats
+{
+	self = [super init];
+	if (self) {
+		_policy = policy;
+		_capacity = capacity;
+		_accesses = stats.total_accesses();
+		_misses = stats.total_misses();
+		_missRatio = _accesses > 0 ? (double)_misses / _accesses : 0;
+	}
+	return self;
+}
+
+- (NSString *)description
+{
+	return [NSString stringWithFormat:@"<MissRatioPoint Policy: %lu, Capacity: %llu, Accesses: %llu, Misses: %llu, Miss Ratio: %f>",
+			(unsigned long)_policy, _capacity, _accesses, _misses, _missRatio];
+}
+
+@end
+
+#pragma mark - Simulation
+
+@interface RocksDBCacheSimulation ()
+{
+	NSArray<NSNumber *> *_capacities;
+	NSArray<NSNumber *> *_policies;
+}
+@end
+
+@implementation RocksDBCacheSimulation
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithCapacities:(NSArray<NSNumber *> *)capacities policies:(NSArray<NSNumber *> *)policies
+{
+	self = [super init];
+	if (self) {
+		_capacities = [capacities copy];
+		_policies = [policies copy];
+		_numShardBits = 6;
+		_warmupSeconds = 0;
+		_downsampleRatio = 1;
+		_ghostCacheCapacity = 0;
+	}
+	return self;
+}
+
+#pragma mark - Simulation
+
+- (NSArray<RocksDBMissRatioPoint *> *)simulateTraceAtPath:(NSString *)path error:(NSError * __autoreleasing *)error
+{
+	std::vector<uint64_t> capacities;
+	for (NSNumber *capacity in _capacities) {
+		capacities.push_back(capacity.unsignedLongLongValue);
+	}
+
+	std::vector<rocksdb::CacheConfiguration> configurations;
+	for (NSNumber *policy in _policies) {
+		rocksdb::CacheConfiguration configuration;
+		configuration.cache_name = CacheName((RocksDBCacheSimulationPolicy)policy.unsignedIntegerValue, _ghostCacheCapacity > 0);
+		configuration.num_shard_bits = _numShardBits;
+		configuration.ghost_cache_capacity = _ghostCacheCapacity;
+		configuration.cache_capacities = capacities;
+		configurations.push_back(configuration);
+	}
+
+	rocksdb::BlockCacheTraceSimulator simulator(_warmupSeconds, MAX(_downsampleRatio, 1u), configurations);
+	rocksdb::Status status = simulator.InitializeCaches();
+
+	std::unique_ptr<rocksdb::TraceReader> traceReader;
+	if (status.ok()) {
+		status = rocksdb::NewFileTraceReader(rocksdb::Env::Default(), rocksdb::EnvOptions(), path.UTF8String, &traceReader);
+	}
+
+	if (status.ok()) {
+		rocksdb::BlockCacheTraceReader reader(std::move(traceReader));
+		rocksdb::BlockCacheTraceHeader header;
+		status = reader.ReadHeader(&header);
+
+		// Read accesses until the end of the trace, which is reported as an error status
+		rocksdb::BlockCacheTraceRecord access;
+		while (status.ok() && reader.ReadAccess(&access).ok()) {
+			simulator.Access(access);
+		}
+	}
+
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+
+	NSMutableArray<RocksDBMissRatioPoint *> *curve = [NSMutableArray array];
+	for (size_t i = 0; i < configurations.size(); i++) {
+		RocksDBCacheSimulationPolicy policy = (RocksDBCacheSimulationPolicy)_policies[i].unsignedIntegerValue;
+		const auto &caches = simulator.sim_caches().at(configurations[i]);
+		for (size_t j = 0; j < caches.size() && j < capacities.size(); j++) {
+			[curve addObject:[[RocksDBMissRatioPoint alloc] initWithPolicy:policy
+																  capacity:capacities[j]
+																	 stats:caches[j]->miss_ratio_stats()]];
+		}
+	}
+	return curve;
+}
+
+@end
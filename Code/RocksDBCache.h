@@ -7,6 +7,7 @@
 //
 
 #import <Foundation/Foundation.h>
+#import "RocksDBColumnFamilyOptions.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -50,6 +51,113 @@ NS_ASSUME_NONNULL_BEGIN
 				 strictCapacityLimit:(BOOL)strictCapacityLimit
 			   highPriorityPoolRatio:(double)highPriorityPoolRatio;
 
+/**
+ Create a new HyperClockCache with a fixed size capacity. This is a lock-free
+ alternative to the LRU cache, designed for highly concurrent lookups. The
+ capacity stays fixed, while the estimated entry charge is tuned automatically,
+ i.e. the hash table grows with the number of entries that fit into the capacity.
+
+ @param capacity The cache capacity.
+ */
++ (instancetype)hyperClockCacheWithCapacity:(size_t)capacity;
+
+/**
+ Create a new HyperClockCache with a fixed size capacity. This is a lock-free
+ alternative to the LRU cache, designed for highly concurrent lookups.
+
+ @param capacity The cache capacity.
+ @param estimatedEntryCharge The estimated average charge of an entry, which
+ is used to size the fixed hash table. 0 selects a dynamically growing table.
+ @param numShardBits The number of shard bits, -1 to pick automatically.
+ @param strictCapacityLimit insert to the cache will fail when cache is full
+ */
++ (instancetype)hyperClockCacheWithCapacity:(size_t)capacity
+					   estimatedEntryCharge:(size_t)estimatedEntryCharge
+							  numShardsBits:(int)numShardBits
+						strictCapacityLimit:(BOOL)strictCapacityLimit;
+
+/**
+ Create a new LRU cache with a compressed secondary cache tier. Blocks evicted from
+ the primary cache are compressed and kept in the secondary tier instead of being
+ dropped, so that a later lookup costs a decompression instead of a read from storage.
+ The blocks are compressed with LZ4.
+
+ @param capacity The capacity of the primary cache.
+ @param secondaryCapacity The capacity of the compressed secondary cache.
+ */
++ (instancetype)LRUCacheWithCapacity:(size_t)capacity compressedSecondaryCapacity:(size_t)secondaryCapacity;
+
+/**
+ Create a new LRU cache with a compressed secondary cache tier.
+
+ @param capacity The capacity of the primary cache.
+ @param secondaryCapacity The capacity of the compressed secondary cache.
+ @param compressionType The compression used for the blocks in the secondary cache.
+
+ @see RocksDBCompressionType
+ */
++ (instancetype)LRUCacheWithCapacity:(size_t)capacity
+		 compressedSecondaryCapacity:(size_t)secondaryCapacity
+					 compressionType:(RocksDBCompressionType)compressionType;
+
+/**
+ Create a new HyperClockCache with a compressed secondary cache tier. Blocks evicted from
+ the primary cache are compressed and kept in the secondary tier instead of being
+ dropped, so that a later lookup costs a decompression instead of a read from storage.
+ The blocks are compressed with LZ4.
+
+ @param capacity The capacity of the primary cache.
+ @param secondaryCapacity The capacity of the compressed secondary cache.
+ */
++ (instancetype)hyperClockCacheWithCapacity:(size_t)capacity compressedSecondaryCapacity:(size_t)secondaryCapacity;
+
+/**
+ Create a new HyperClockCache with a compressed secondary cache tier.
+
+ @param capacity The capacity of the primary cache.
+ @param secondaryCapacity The capacity of the compressed secondary cache.
+ @param compressionType The compression used for the blocks in the secondary cache.
+
+ @see RocksDBCompressionType
+ */
++ (instancetype)hyperClockCacheWithCapacity:(size_t)capacity
+				compressedSecondaryCapacity:(size_t)secondaryCapacity
+							compressionType:(RocksDBCompressionType)compressionType;
+
+/**
+ @brief The maximum configured capacity of the cache. Setting a smaller capacity
+ than the current usage purges entries until the usage fits, when possible.
+ */
+@property (nonatomic, assign) size_t capacity;
+
+/**
+ @brief Whether inserting into the cache fails when the cache is full.
+ */
+@property (nonatomic, assign) BOOL strictCapacityLimit;
+
+/**
+ @brief The memory size of all the entries residing in the cache.
+ */
+@property (nonatomic, readonly) size_t usage;
+
+/**
+ @brief The memory size of the entries in use by the system, i.e. pinned
+ and not evictable.
+ */
+@property (nonatomic, readonly) size_t pinnedUsage;
+
+/**
+ @brief The capacity of the compressed secondary cache tier, or 0 if this
+ cache has no secondary tier.
+ */
+@property (nonatomic, readonly) size_t secondaryCapacity;
+
+/**
+ @brief The memory size of the compressed entries residing in the secondary
+ cache tier, or 0 if this cache has no secondary tier.
+ */
+@property (nonatomic, readonly) size_t secondaryUsage;
+
 @end
 
 NS_ASSUME_NONNULL_END
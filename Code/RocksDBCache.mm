@@ -9,14 +9,25 @@
 #import "RocksDBCache.h"
 
 #import <rocksdb/cache.h>
+#import <rocksdb/secondary_cache.h>
 
 @interface RocksDBCache ()
 {
 	std::shared_ptr<rocksdb::Cache> _cache;
+	std::shared_ptr<rocksdb::SecondaryCache> _secondaryCache;
 }
 @property (nonatomic, assign) std::shared_ptr<rocksdb::Cache> cache;
+@property (nonatomic, assign, getter=isHyperClockCache) BOOL hyperClockCache;
 @end
 
+static std::shared_ptr<rocksdb::SecondaryCache> CompressedSecondaryCache(size_t capacity, RocksDBCompressionType compressionType)
+{
+	rocksdb::CompressedSecondaryCacheOptions options;
+	options.capacity = capacity;
+	options.compression_type = (rocksdb::CompressionType)compressionType;
+	return rocksdb::NewCompressedSecondaryCache(options);
+}
+
 @implementation RocksDBCache
 @synthesize cache = _cache;
 
@@ -38,6 +49,66 @@
 	return [[RocksDBCache alloc] initWithNativeCache:rocksdb::NewLRUCache(capacity, numShardBits, strictCapacityLimit, highPriorityPoolRatio)];
 }
 
++ (instancetype)hyperClockCacheWithCapacity:(size_t)capacity
+{
+	return [self hyperClockCacheWithCapacity:capacity estimatedEntryCharge:0 numShardsBits:-1 strictCapacityLimit:NO];
+}
+
++ (instancetype)hyperClockCacheWithCapacity:(size_t)capacity
+					   estimatedEntryCharge:(size_t)estimatedEntryCharge
+							  numShardsBits:(int)numShardBits
+						strictCapacityLimit:(BOOL)strictCapacityLimit
+{
+	rocksdb::HyperClockCacheOptions options(capacity, estimatedEntryCharge, numShardBits, strictCapacityLimit);
+	RocksDBCache *instance = [[RocksDBCache alloc] initWithNativeCache:options.MakeSharedCache()];
+	instance.hyperClockCache = YES;
+	return instance;
+}
+
++ (instancetype)LRUCacheWithCapacity:(size_t)capacity compressedSecondaryCapacity:(size_t)secondaryCapacity
+{
+	return [self LRUCacheWithCapacity:capacity
+		  compressedSecondaryCapacity:secondaryCapacity
+					  compressionType:RocksDBCompressionLZ4];
+}
+
++ (instancetype)LRUCacheWithCapacity:(size_t)capacity
+		 compressedSecondaryCapacity:(size_t)secondaryCapacity
+					 compressionType:(RocksDBCompressionType)compressionType
+{
+	std::shared_ptr<rocksdb::SecondaryCache> secondaryCache = CompressedSecondaryCache(secondaryCapacity, compressionType);
+
+	rocksdb::LRUCacheOptions options;
+	options.capacity = capacity;
+	options.secondary_cache = secondaryCache;
+
+	RocksDBCache *instance = [[RocksDBCache alloc] initWithNativeCache:options.MakeSharedCache()];
+	instance->_secondaryCache = secondaryCache;
+	return instance;
+}
+
++ (instancetype)hyperClockCacheWithCapacity:(size_t)capacity compressedSecondaryCapacity:(size_t)secondaryCapacity
+{
+	return [self hyperClockCacheWithCapacity:capacity
+				 compressedSecondaryCapacity:secondaryCapacity
+							 compressionType:RocksDBCompressionLZ4];
+}
+
++ (instancetype)hyperClockCacheWithCapacity:(size_t)capacity
+				compressedSecondaryCapacity:(size_t)secondaryCapacity
+							compressionType:(RocksDBCompressionType)compressionType
+{
+	std::shared_ptr<rocksdb::SecondaryCache> secondaryCache = CompressedSecondaryCache(secondaryCapacity, compressionType);
+
+	rocksdb::HyperClockCacheOptions options(capacity, 0);
+	options.secondary_cache = secondaryCache;
+
+	RocksDBCache *instance = [[RocksDBCache alloc] initWithNativeCache:options.MakeSharedCache()];
+	instance->_secondaryCache = secondaryCache;
+	instance.hyperClockCache = YES;
+	return instance;
+}
+
 - (instancetype)initWithNativeCache:(std::shared_ptr<rocksdb::Cache>)cache
 {
 	self = [super init];
@@ -47,12 +118,65 @@
 	return self;
 }
 
+#pragma mark - Capacity & Usage
+
+- (void)setCapacity:(size_t)capacity
+{
+	_cache->SetCapacity(capacity);
+}
+
+- (size_t)capacity
+{
+	return _cache->GetCapacity();
+}
+
+- (void)setStrictCapacityLimit:(BOOL)strictCapacityLimit
+{
+	_cache->SetStrictCapacityLimit(strictCapacityLimit);
+}
+
+- (BOOL)strictCapacityLimit
+{
+	return _cache->HasStrictCapacityLimit();
+}
+
+- (size_t)usage
+{
+	return _cache->GetUsage();
+}
+
+- (size_t)pinnedUsage
+{
+	return _cache->GetPinnedUsage();
+}
+
+- (size_t)secondaryCapacity
+{
+	size_t capacity = 0;
+	if (_secondaryCache != nullptr) {
+		_secondaryCache->GetCapacity(capacity);
+	}
+	return capacity;
+}
+
+- (size_t)secondaryUsage
+{
+	size_t usage = 0;
+	if (_secondaryCache != nullptr) {
+		_secondaryCache->GetUsage(usage);
+	}
+	return usage;
+}
+
 - (void)dealloc
 {
 	@synchronized(self) {
 		if (_cache != nullptr) {
 			_cache.reset();
 		}
+		if (_secondaryCache != nullptr) {
+			_secondaryCache.reset();
+		}
 	}
 }
 
@@ -0,0 +1,137 @@
+//
+//  RocksDBCachePrewarmer.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+#import "RocksDB.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDBPrewarmRange;
+
+/**
+ A compact profile of the hottest key ranges of a DB, used to prewarm the block cache
+ after the DB is reopened.
+
+ @discussion The profile is captured from the per-file read sampling RocksDB performs
+ on every SST file, as exposed by `-[RocksDBSstFileMetaData numReadsSampled]`. Each
+ range covers the key range of one SST file and is weighted by its sampled reads.
+
+ @see RocksDBCachePrewarmer
+ */
+@interface RocksDBPrewarmProfile : NSObject
+
+/**
+ Captures the profile of the given DB, over all its Column Families.
+
+ @param database The DB to capture the profile of.
+ @param maxRanges The maximum number of ranges to keep, hottest first.
+ @return A newly-initialized profile.
+ */
++ (instancetype)profileWithDatabase:(RocksDB *)database maxRanges:(NSUInteger)maxRanges;
+
+/**
+ Loads a profile previously written with `writeToFile:error:`.
+
+ @param path The path of the profile file.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The loaded profile, nil on error.
+ */
++ (nullable instancetype)profileWithContentsOfFile:(NSString *)path error:(NSError * __autoreleasing *)error;
+
+/**
+ Persists the profile to the given path.
+
+ @param path The path of the profile file.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return `YES` if the profile was written, `NO` otherwise.
+ */
+- (BOOL)writeToFile:(NSString *)path error:(NSError * __autoreleasing *)error;
+
+/** @brief The ranges of this profile, hottest first. */
+@property (nonatomic, strong, readonly) NSArray<RocksDBPrewarmRange *> *ranges;
+
+@end
+
+/**
+ A single key range of a prewarm profile.
+ */
+@interface RocksDBPrewarmRange : NSObject
+
+/** @brief The name of the Column Family of this range. */
+@property (nonatomic, copy, readonly) NSString *columnFamilyName;
+
+/** @brief The smallest key of the range, inclusive. */
+@property (nonatomic, strong, readonly) NSData *start;
+
+/** @brief The largest key of the range, inclusive. */
+@property (nonatomic, strong, readonly) NSData *end;
+
+/** @brief The number of sampled reads of this range when the profile was captured. */
+@property (nonatomic, readonly) uint64_t readsSampled;
+
+/** @brief The size in bytes of the data in this range when the profile was captured. */
+@property (nonatomic, readonly) uint64_t size;
+
+@end
+
+/**
+ Replays a prewarm profile on a background queue, reading the hottest ranges in order
+ to load their index and data blocks into the block cache. A point lookup on one key of
+ every 64 KB read also loads the filter blocks covering the range. Without
+ `cacheIndexAndFilterBlocks` the filters are held by the table readers instead, which the
+ lookups open as well.
+
+ @discussion The reads are issued with a low I/O priority, so a rate limiter configured on
+ the DB throttles them first. The prewarmer must be cancelled, or must have finished,
+ before the DB is closed.
+ */
+@interface RocksDBCachePrewarmer : NSObject
+
+/**
+ Initializes a prewarmer for the given DB and profile.
+
+ @param database The DB to prewarm.
+ @param profile The profile to replay. Ranges of Column Families that are not open are skipped.
+ @return A newly-initialized prewarmer.
+ */
+- (instancetype)initWithDatabase:(RocksDB *)database profile:(RocksDBPrewarmProfile *)profile;
+
+/** @brief The maximum number of bytes read per second, 0 for no limit.
+ Default: 0
+ */
+@property (nonatomic, assign) uint64_t bytesPerSecond;
+
+/** @brief The number of ranges replayed concurrently.
+ Default: 1
+ */
+@property (nonatomic, assign) NSUInteger parallelism;
+
+/** @brief A block called on a background queue after each replayed range. */
+@property (nonatomic, copy, nullable) void (^progressBlock)(NSUInteger completedRanges, NSUInteger totalRanges, uint64_t bytesLoaded);
+
+/** @brief `YES` while the profile is being replayed. */
+@property (nonatomic, readonly, getter=isRunning) BOOL running;
+
+/**
+ Starts replaying the profile in the background.
+
+ @param completion A block called on a background queue once all ranges were replayed,
+ or the prewarmer was cancelled. The error is non-nil if a read failed.
+ */
+- (void)startWithCompletion:(nullable void (^)(NSError * _Nullable error))completion;
+
+/**
+ Cancels the replay and waits until the background reads have stopped.
+ */
+- (void)cancel;
+
+/**
+ Blocks the calling thread until the replay is finished or cancelled.
+ */
+- (void)waitUntilFinished;
+
+@end
+
+NS_ASSUME_NONNULL_END
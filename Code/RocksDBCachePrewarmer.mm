@@ -0,0 +1,397 @@
+//
+//  RocksDBCachePrewarmer.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBCachePrewarmer.h"
+#import "RocksDB+Private.h"
+#import "RocksDBColumnFamilyHandle+Private.h"
+#import "RocksDBColumnFamilyMetadata.h"
+#import "RocksDBSlice+Private.h"
+#import "RocksDBError.h"
+
+#import <rocksdb/db.h>
+#import <rocksdb/env.h>
+#import <rocksdb/comparator.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+static NSString * const RocksDBPrewarmProfileVersionKey = @"version";
+static NSString * const RocksDBPrewarmProfileRangesKey = @"ranges";
+static NSString * const RocksDBPrewarmRangeColumnFamilyKey = @"cf";
+static NSString * const RocksDBPrewarmRangeStartKey = @"start";
+static NSString * const RocksDBPrewarmRangeEndKey = @"end";
+static NSString * const RocksDBPrewarmRangeReadsKey = @"reads";
+static NSString * const RocksDBPrewarmRangeSizeKey = @"size";
+
+static const NSInteger RocksDBPrewarmProfileVersion = 1;
+
+#pragma mark - Range
+
+@interface RocksDBPrewarmRange ()
+- (instancetype)initWithColumnFamilyName:(NSString *)columnFamilyName
+								   start:(NSData *)start
+									 end:(NSData *)end
+							readsSampled:(uint64_t)readsSampled
+									size:(uint64_t)size;
+@end
+
+@implementation RocksDBPrewarmRange
+
+- (instancetype)initWithColumnFamilyName:(NSString *)columnFamilyName
+								   start:(NSData *)start
+									 end:(NSData *)end
+							readsSampled:(uint64_t)readsSampled
+									size:(uint64_t)size
+{
+	self = [super init];
+	if (self) {
+		_columnFamilyName = [columnFamilyName copy];
+		_start = start;
+		_end = end;
+		_readsSampled = readsSampled;
+		_size = size;
+	}
+	return self;
+}
+
+@end
+
+#pragma mark - Profile
+
+@interface RocksDBPrewarmProfile ()
+- (instancetype)initWithRanges:(NSArray<RocksDBPrewarmRange *> *)ranges;
+@end
+
+@implementation RocksDBPrewarmProfile
+
++ (instancetype)profileWithDatabase:(RocksDB *)database maxRanges:(NSUInteger)maxRanges
+{
+	NSArray<RocksDBColumnFamilyHandle *> *handles = database.columnFamilies;
+	if (handles.count == 0) {
+		handles = @[database.columnFamily];
+	}
+
+	NSMutableArray<RocksDBPrewarmRange *> *ranges = [NSMutableArray array];
+	for (RocksDBColumnFamilyHandle *handle in handles) {
+		RocksDBColumnFamilyMetaData *metadata = [database columnFamilyMetaData:handle];
+		for (RocksDBLevelFileMetaData *level in metadata.levels) {
+			for (RocksDBSstFileMetaData *file in level.files) {
+				if (file.numReadsSampled == 0) {
+					continue;
+				}
+				[ranges addObject:[[RocksDBPrewarmRange alloc] initWithColumnFamilyName:metadata.name
+																				  start:file.smallestKey
+																					end:file.largestKey
+																		   readsSampled:file.numReadsSampled
+																				   size:file.size]];
+			}
+		}
+	}
+
+	[ranges sortUsingComparator:^NSComparisonResult(RocksDBPrewarmRange *range1, RocksDBPrewarmRange *range2) {
+		if (range1.readsSampled == range2.readsSampled) {
+			return NSOrderedSame;
+		}
+		return range1.readsSampled > range2.readsSampled ? NSOrderedAscending : NSOrderedDescending;
+	}];
+
+	if (ranges.count > maxRanges) {
+		[ranges removeObjectsInRange:NSMakeRange(maxRanges, ranges.count - maxRanges)];
+	}
+
+	return [[self alloc] initWithRanges:ranges];
+}
+
++ (instancetype)profileWithContentsOfFile:(NSString *)path error:(NSError * __autoreleasing *)error
+{
+	NSData *data = [NSData dataWithContentsOfFile:path options:0 error:error];
+	if (data == nil) {
+		return nil;
+	}
+
+	id plist = [NSPropertyListSerialization propertyListWithData:data
+														 options:NSPropertyListImmutable
+														  format:NULL
+														   error:error];
+	if (plist == nil) {
+		return nil;
+	}
+
+	NSArray *entries = [plist isKindOfClass:[NSDictionary class]] ? plist[RocksDBPrewarmProfileRangesKey] : nil;
+	BOOL valid = [entries isKindOfClass:[NSArray class]] && [plist[RocksDBPrewarmProfileVersionKey] isEqual:@(RocksDBPrewarmProfileVersion)];
+
+	NSMutableArray<RocksDBPrewarmRange *> *ranges = [NSMutableArray array];
+	for (NSDictionary *entry in (valid ? entries : nil)) {
+		if (![entry isKindOfClass:[NSDictionary class]]) {
+			valid = NO;
+			break;
+		}
+
+		NSString *columnFamilyName = entry[RocksDBPrewarmRangeColumnFamilyKey];
+		NSData *start = entry[RocksDBPrewarmRangeStartKey];
+		NSData *end = entry[RocksDBPrewarmRangeEndKey];
+		NSNumber *reads = entry[RocksDBPrewarmRangeReadsKey];
+		NSNumber *size = entry[RocksDBPrewarmRangeSizeKey];
+		if (![columnFamilyName isKindOfClass:[NSString class]] ||
+			![start isKindOfClass:[NSData class]] ||
+			![end isKindOfClass:[NSData class]] ||
+			![reads isKindOfClass:[NSNumber class]] ||
+			![size isKindOfClass:[NSNumber class]]) {
+			valid = NO;
+			break;
+		}
+
+		[ranges addObject:[[RocksDBPrewarmRange alloc] initWithColumnFamilyName:columnFamilyName
+																		  start:start
+																			end:end
+																   readsSampled:reads.unsignedLongLongValue
+																		   size:size.unsignedLongLongValue]];
+	}
+
+	if (!valid) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:rocksdb::Status::Corruption("Invalid prewarm profile", path.UTF8String)];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+	return [[self alloc] initWithRanges:ranges];
+}
+
+- (instancetype)initWithRanges:(NSArray<RocksDBPrewarmRange *> *)ranges
+{
+	self = [super init];
+	if (self) {
+		_ranges = [ranges copy];
+	}
+	return self;
+}
+
+- (BOOL)writeToFile:(NSString *)path error:(NSError * __autoreleasing *)error
+{
+	NSMutableArray *entries = [NSMutableArray arrayWithCapacity:_ranges.count];
+	for (RocksDBPrewarmRange *range in _ranges) {
+		[entries addObject:@{
+							 RocksDBPrewarmRangeColumnFamilyKey: range.columnFamilyName,
+							 RocksDBPrewarmRangeStartKey: range.start,
+							 RocksDBPrewarmRangeEndKey: range.end,
+							 RocksDBPrewarmRangeReadsKey: @(range.readsSampled),
+							 RocksDBPrewarmRangeSizeKey: @(range.size)
+							 }];
+	}
+
+	NSDictionary *plist = @{
+							RocksDBPrewarmProfileVersionKey: @(RocksDBPrewarmProfileVersion),
+							RocksDBPrewarmProfileRangesKey: entries
+							};
+
+	NSData *data = [NSPropertyListSerialization dataWithPropertyList:plist
+															  format:NSPropertyListBinaryFormat_v1_0
+															 options:0
+															   error:error];
+	if (data == nil) {
+		return NO;
+	}
+	return [data writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+@end
+
+#pragma mark - Prewarmer
+
+@interface RocksDBCachePrewarmer ()
+{
+	RocksDB *_database;
+	RocksDBPrewarmProfile *_profile;
+
+	dispatch_group_t _group;
+	std::atomic<bool> _cancelled;
+	std::atomic<bool> _running;
+	std::atomic<NSUInteger> _nextRange;
+	std::atomic<NSUInteger> _completedRanges;
+	std::atomic<uint64_t> _bytesLoaded;
+	std::chrono::steady_clock::time_point _startTime;
+
+	NSError *_error;
+}
+@end
+
+@implementation RocksDBCachePrewarmer
+
+- (instancetype)initWithDatabase:(RocksDB *)database profile:(RocksDBPrewarmProfile *)profile
+{
+	self = [super init];
+	if (self) {
+		_database = database;
+		_profile = profile;
+		_parallelism = 1;
+		_group = dispatch_group_create();
+		_cancelled = false;
+		_running = false;
+	}
+	return self;
+}
+
+- (BOOL)isRunning
+{
+	return _running;
+}
+
+- (void)startWithCompletion:(void (^)(NSError *))completion
+{
+	@synchronized(self) {
+		if (_running) {
+			return;
+		}
+		_running = true;
+		_cancelled = false;
+		_nextRange = 0;
+		_completedRanges = 0;
+		_bytesLoaded = 0;
+		_error = nil;
+		_startTime = std::chrono::steady_clock::now();
+	}
+
+	NSMutableDictionary<NSString *, RocksDBColumnFamilyHandle *> *handles = [NSMutableDictionary dictionary];
+	for (RocksDBColumnFamilyHandle *handle in _database.columnFamilies) {
+		handles[[[NSString alloc] initWithData:handle.name encoding:NSUTF8StringEncoding]] = handle;
+	}
+	if (handles.count == 0) {
+		handles[@"default"] = _database.columnFamily;
+	}
+
+	dispatch_queue_t queue = dispatch_get_global_queue(QOS_CLASS_UTILITY, 0);
+	NSUInteger workers = MAX(1, MIN(_parallelism, _profile.ranges.count));
+
+	dispatch_group_async(_group, queue, ^{
+		dispatch_group_t workersGroup = dispatch_group_create();
+		for (NSUInteger i = 0; i < workers; i++) {
+			dispatch_group_async(workersGroup, queue, ^{
+				[self replayRangesWithHandles:handles];
+			});
+		}
+		dispatch_group_wait(workersGroup, DISPATCH_TIME_FOREVER);
+
+		NSError *error = nil;
+		@synchronized(self) {
+			error = self->_error;
+			self->_running = false;
+		}
+		if (completion) {
+			completion(error);
+		}
+	});
+}
+
+- (void)replayRangesWithHandles:(NSDictionary<NSString *, RocksDBColumnFamilyHandle *> *)handles
+{
+	NSArray<RocksDBPrewarmRange *> *ranges = _profile.ranges;
+
+	while (!_cancelled) {
+		NSUInteger index = _nextRange++;
+		if (index >= ranges.count) {
+			break;
+		}
+
+		RocksDBPrewarmRange *range = ranges[index];
+		RocksDBColumnFamilyHandle *handle = handles[range.columnFamilyName];
+		if (handle != nil) {
+			rocksdb::Status status = [self replayRange:range inColumnFamily:handle.columnFamily];
+			if (!status.ok()) {
+				@synchronized(self) {
+					if (_error == nil) {
+						_error = [RocksDBError errorWithRocksStatus:status];
+					}
+				}
+				_cancelled = true;
+				break;
+			}
+		}
+
+		NSUInteger completed = ++_completedRanges;
+		void (^progressBlock)(NSUInteger, NSUInteger, uint64_t) = self.progressBlock;
+		if (progressBlock) {
+			progressBlock(completed, ranges.count, _bytesLoaded);
+		}
+	}
+}
+
+- (rocksdb::Status)replayRange:(RocksDBPrewarmRange *)range inColumnFamily:(rocksdb::ColumnFamilyHandle *)columnFamily
+{
+	rocksdb::ReadOptions readOptions;
+	readOptions.fill_cache = true;
+	readOptions.rate_limiter_priority = rocksdb::Env::IO_LOW;
+
+	const rocksdb::Comparator *comparator = columnFamily->GetComparator();
+	rocksdb::Slice end = SliceFromData(range.end);
+
+	std::unique_ptr<rocksdb::Iterator> iterator(_database.db->NewIterator(readOptions, columnFamily));
+	uint64_t pending = 0;
+	bool sampleKey = true;
+	for (iterator->Seek(SliceFromData(range.start)); iterator->Valid() && !_cancelled; iterator->Next()) {
+		if (comparator->Compare(iterator->key(), end) > 0) {
+			break;
+		}
+
+		// Iterators never consult filters, so a point lookup on a sampled key of each chunk
+		// loads the filter block, or the filter partition, covering it
+		if (sampleKey) {
+			rocksdb::Status status = [self lookupKey:iterator->key() withOptions:readOptions inColumnFamily:columnFamily];
+			if (!status.ok()) {
+				return status;
+			}
+			sampleKey = false;
+		}
+
+		pending += iterator->key().size() + iterator->value().size();
+		if (pending >= 64 * 1024) {
+			[self throttleWithLoadedBytes:pending];
+			pending = 0;
+			sampleKey = true;
+		}
+	}
+	[self throttleWithLoadedBytes:pending];
+
+	return iterator->status();
+}
+
+- (rocksdb::Status)lookupKey:(const rocksdb::Slice &)key
+				 withOptions:(const rocksdb::ReadOptions &)readOptions
+			  inColumnFamily:(rocksdb::ColumnFamilyHandle *)columnFamily
+{
+	rocksdb::PinnableSlice value;
+	rocksdb::Status status = _database.db->Get(readOptions, columnFamily, key, &value);
+	return status.IsNotFound() ? rocksdb::Status::OK() : status;
+}
+
+- (void)throttleWithLoadedBytes:(uint64_t)bytes
+{
+	uint64_t total = (_bytesLoaded += bytes);
+	uint64_t bytesPerSecond = _bytesPerSecond;
+	if (bytesPerSecond == 0) {
+		return;
+	}
+
+	auto expected = std::chrono::duration<double>((double)total / bytesPerSecond);
+	auto elapsed = std::chrono::steady_clock::now() - _startTime;
+	if (expected > elapsed) {
+		std::this_thread::sleep_for(expected - elapsed);
+	}
+}
+
+- (void)cancel
+{
+	_cancelled = true;
+	[self waitUntilFinished];
+}
+
+- (void)waitUntilFinished
+{
+	dispatch_group_wait(_group, DISPATCH_TIME_FOREVER);
+}
+
+@end
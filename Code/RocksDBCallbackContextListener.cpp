@@ -0,0 +1,86 @@
+//
+//  RocksDBCallbackContextListener.cpp
+//  ObjectiveRocks
+//
+
+#import "RocksDBCallbackContextListener.h"
+
+// The number of flushes, compactions and subcompactions the calling thread is running.
+// A compaction thread also runs one of its subcompactions and an atomic flush begins once
+// per column family, hence depths rather than flags. Manual compactions may run on user
+// threads, so the depths drop back once a job completes.
+static thread_local int flushDepth = 0;
+static thread_local int compactionDepth = 0;
+
+static void EndBackgroundJob(int &depth)
+{
+	if (depth > 0) {
+		depth--;
+	}
+}
+
+class RocksDBCallbackContextListenerImpl : public rocksdb::EventListener
+{
+public:
+	virtual const char* Name() const override
+	{
+		return "ObjectiveRocks.CallbackContextListener";
+	}
+
+	virtual void OnFlushBegin(rocksdb::DB* db, const rocksdb::FlushJobInfo& info) override
+	{
+		flushDepth++;
+	}
+
+	virtual void OnFlushCompleted(rocksdb::DB* db, const rocksdb::FlushJobInfo& info) override
+	{
+		EndBackgroundJob(flushDepth);
+	}
+
+	virtual void OnBackgroundError(rocksdb::BackgroundErrorReason reason, rocksdb::Status* status) override
+	{
+		// A failed flush never completes and is reported here on the flushing thread instead.
+		// Failed compactions still complete, so only the flush depth is dropped.
+		switch (reason) {
+			case rocksdb::BackgroundErrorReason::kFlush:
+			case rocksdb::BackgroundErrorReason::kFlushNoWAL:
+			case rocksdb::BackgroundErrorReason::kManifestWrite:
+			case rocksdb::BackgroundErrorReason::kManifestWriteNoWAL:
+				flushDepth = 0;
+				break;
+			default:
+				break;
+		}
+	}
+
+	virtual void OnCompactionBegin(rocksdb::DB* db, const rocksdb::CompactionJobInfo& info) override
+	{
+		compactionDepth++;
+	}
+
+	virtual void OnCompactionCompleted(rocksdb::DB* db, const rocksdb::CompactionJobInfo& info) override
+	{
+		EndBackgroundJob(compactionDepth);
+	}
+
+	virtual void OnSubcompactionBegin(const rocksdb::SubcompactionJobInfo& info) override
+	{
+		compactionDepth++;
+	}
+
+	virtual void OnSubcompactionCompleted(const rocksdb::SubcompactionJobInfo& info) override
+	{
+		EndBackgroundJob(compactionDepth);
+	}
+};
+
+std::shared_ptr<rocksdb::EventListener> RocksDBCallbackContextListener()
+{
+	static std::shared_ptr<rocksdb::EventListener> listener = std::make_shared<RocksDBCallbackContextListenerImpl>();
+	return listener;
+}
+
+bool RocksDBIsBackgroundCallbackThread()
+{
+	return flushDepth > 0 || compactionDepth > 0;
+}
@@ -0,0 +1,23 @@
+//
+//  RocksDBCallbackContextListener.h
+//  ObjectiveRocks
+//
+
+#ifndef __ObjectiveRocks__RocksDBCallbackContextListener__
+#define __ObjectiveRocks__RocksDBCallbackContextListener__
+
+#import <rocksdb/listener.h>
+
+#include <memory>
+
+/**
+ Returns the listener that marks threads running flushes and compactions as background threads.
+ */
+extern std::shared_ptr<rocksdb::EventListener> RocksDBCallbackContextListener();
+
+/**
+ Returns true if the calling thread is running a flush or a compaction.
+ */
+extern bool RocksDBIsBackgroundCallbackThread();
+
+#endif /* defined(__ObjectiveRocks__RocksDBCallbackContextListener__) */
@@ -0,0 +1,102 @@
+//
+//  RocksDBCallbackTablePropertiesCollector.cpp
+//  ObjectiveRocks
+//
+
+#import "RocksDBCallbackTablePropertiesCollector.h"
+
+class RocksDBCallbackTablePropertiesCollectorImpl : public rocksdb::TablePropertiesCollector
+{
+private:
+	void* instance;
+	void* state;
+	const char* name;
+	CollectorAddCallback addCallback;
+	CollectorFinishCallback finishCallback;
+	CollectorReleaseCallback releaseCallback;
+	rocksdb::UserCollectedProperties finished;
+
+public:
+	RocksDBCallbackTablePropertiesCollectorImpl(void* instance,
+												void* state,
+												const char* name,
+												CollectorAddCallback add,
+												CollectorFinishCallback finish,
+												CollectorReleaseCallback release):
+	instance(instance), state(state), name(name), addCallback(add), finishCallback(finish), releaseCallback(release) {}
+
+	virtual ~RocksDBCallbackTablePropertiesCollectorImpl()
+	{
+		releaseCallback(instance, state);
+	}
+
+	virtual const char* Name() const
+	{
+		return name;
+	}
+
+	virtual rocksdb::Status AddUserKey(const rocksdb::Slice& key,
+									   const rocksdb::Slice& value,
+									   rocksdb::EntryType type,
+									   rocksdb::SequenceNumber seq,
+									   uint64_t file_size)
+	{
+		if (type == rocksdb::kEntryPut || type == rocksdb::kEntryMerge) {
+			addCallback(instance, state, key, value);
+		}
+		return rocksdb::Status::OK();
+	}
+
+	virtual rocksdb::Status Finish(rocksdb::UserCollectedProperties* properties)
+	{
+		finishCallback(instance, state, properties);
+		finished = *properties;
+		return rocksdb::Status::OK();
+	}
+
+	virtual rocksdb::UserCollectedProperties GetReadableProperties() const
+	{
+		return finished;
+	}
+};
+
+class RocksDBCallbackTablePropertiesCollectorFactoryImpl : public rocksdb::TablePropertiesCollectorFactory
+{
+private:
+	void* instance;
+	const char* name;
+	CollectorStartCallback startCallback;
+	CollectorAddCallback addCallback;
+	CollectorFinishCallback finishCallback;
+	CollectorReleaseCallback releaseCallback;
+
+public:
+	RocksDBCallbackTablePropertiesCollectorFactoryImpl(void* instance,
+													   const char* name,
+													   CollectorStartCallback start,
+													   CollectorAddCallback add,
+													   CollectorFinishCallback finish,
+													   CollectorReleaseCallback release):
+	instance(instance), name(name), startCallback(start), addCallback(add), finishCallback(finish), releaseCallback(release) {}
+
+	virtual const char* Name() const
+	{
+		return name;
+	}
+
+	virtual rocksdb::TablePropertiesCollector* CreateTablePropertiesCollector(rocksdb::TablePropertiesCollectorFactory::Context context)
+	{
+		return new RocksDBCallbackTablePropertiesCollectorImpl(instance, startCallback(instance), name,
+															   addCallback, finishCallback, releaseCallback);
+	}
+};
+
+rocksdb::TablePropertiesCollectorFactory* RocksDBCallbackTablePropertiesCollectorFactory(void* instance,
+																					   const char* name,
+																					   CollectorStartCallback start,
+																					   CollectorAddCallback add,
+																					   CollectorFinishCallback finish,
+																					   CollectorReleaseCallback release)
+{
+	return new RocksDBCallbackTablePropertiesCollectorFactoryImpl(instance, name, start, add, finish, release);
+}
@@ -0,0 +1,24 @@
+//
+//  RocksDBCallbackTablePropertiesCollector.h
+//  ObjectiveRocks
+//
+
+#ifndef __ObjectiveRocks__RocksDBCallbackTablePropertiesCollector__
+#define __ObjectiveRocks__RocksDBCallbackTablePropertiesCollector__
+
+#import <rocksdb/slice.h>
+#import <rocksdb/table_properties.h>
+
+typedef void* (* CollectorStartCallback)(void* instance);
+typedef void (* CollectorAddCallback)(void* instance, void* state, const rocksdb::Slice& key, const rocksdb::Slice& value);
+typedef void (* CollectorFinishCallback)(void* instance, void* state, rocksdb::UserCollectedProperties* properties);
+typedef void (* CollectorReleaseCallback)(void* instance, void* state);
+
+extern rocksdb::TablePropertiesCollectorFactory* RocksDBCallbackTablePropertiesCollectorFactory(void* instance,
+																							  const char* name,
+																							  CollectorStartCallback start,
+																							  CollectorAddCallback add,
+																							  CollectorFinishCallback finish,
+																							  CollectorReleaseCallback release);
+
+#endif /* defined(__ObjectiveRocks__RocksDBCallbackTablePropertiesCollector__) */
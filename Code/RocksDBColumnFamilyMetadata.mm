@@ -65,7 +65,7 @@
 		self->_smallestSeqno = metadata.smallest_seqno;
 		self->_largestSeqno = metadata.largest_seqno;
 		self->_smallestKey = [[NSData alloc] initWithBytes:metadata.smallestkey.data() length:metadata.smallestkey.size()];
-		self->_largestKey = [[NSData alloc] initWithBytes:metadata.largestkey.data() length:metadata.smallestkey.size()];
+		self->_largestKey = [[NSData alloc] initWithBytes:metadata.largestkey.data() length:metadata.largestkey.size()];
 		self->_beingCompacted = metadata.being_compacted;
 		self->_numReadsSampled = metadata.num_reads_sampled;
 		self->_numEntries = metadata.num_entries;
@@ -13,6 +13,8 @@
 @class RocksDBComparator;
 @class RocksDBMergeOperator;
 @class RocksDBPrefixExtractor;
+@class RocksDBTablePropertiesCollectorFactory;
+@class RocksDBCompressionOptions;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -33,7 +35,11 @@ typedef NS_ENUM(char, RocksDBCompressionType)
 	RocksDBCompressionZlib = 0x2,
 	RocksDBCompressionBZip2 = 0x3,
 	RocksDBCompressionLZ4 = 0x4,
-	RocksDBCompressionLZ4HC = 0x5
+	RocksDBCompressionLZ4HC = 0x5,
+	RocksDBCompressionXpress = 0x6,
+	RocksDBCompressionZSTD = 0x7,
+	/** Only valid for `bottommostCompressionType`: use the regular compression settings. */
+	RocksDBCompressionDisableOption = (char)0xFF
 };
 
 @interface RocksDBColumnFamilyOptions : NSObject
@@ -79,6 +85,34 @@ typedef NS_ENUM(char, RocksDBCompressionType)
  */
 @property (nonatomic, assign) RocksDBCompressionType compressionType;
 
+/** @brief Compress the blocks of each level with a different compression algorithm.
+ Each element is a `RocksDBCompressionType`, the first for level-0. When set, the array
+ takes precedence over `compressionType`, and levels past the end of the array use its
+ last element. A common setup is no or LZ4 compression for the upper levels, which are
+ rewritten often, and ZSTD for the lower levels, which hold most of the data.
+ Default: empty
+ */
+@property (nonatomic, copy) NSArray<NSNumber *> *compressionPerLevel;
+
+/** @brief Compress the blocks of the bottommost level with this algorithm, overriding
+ `compressionType` and `compressionPerLevel` for it.
+ Default: RocksDBCompressionDisableOption
+ */
+@property (nonatomic, assign) RocksDBCompressionType bottommostCompressionType;
+
+/** @brief Options to fine-tune the compression algorithms, e.g. dictionary compression.
+
+ @see RocksDBCompressionOptions
+ */
+@property (nonatomic, strong, readonly) RocksDBCompressionOptions *compressionOptions;
+
+/** @brief Options to fine-tune the compression algorithm of the bottommost level. These
+ take effect only when `enabled` is set on them.
+
+ @see RocksDBCompressionOptions
+ */
+@property (nonatomic, strong, readonly) RocksDBCompressionOptions *bottommostCompressionOptions;
+
 /** @brief Set compaction style for DB.
  Default: RocksDBCompactionStyleLevel
  */
@@ -168,6 +202,21 @@ typedef NS_ENUM(char, RocksDBCompressionType)
  */
 @property (nonatomic, strong, nullable) RocksDBTableFactory *tableFacotry;
 
+#if !defined(ROCKSDB_LITE)
+
+/** @brief A list of factories for the collectors that gather user-defined properties
+ while SST files are built. The collected properties can be read back via
+ `-[RocksDB propertiesOfAllTables:]`.
+ Default: empty
+
+ @see RocksDBTablePropertiesCollectorFactory
+
+ @warning Not available in RocksDB Lite.
+ */
+@property (nonatomic, copy) NSArray<RocksDBTablePropertiesCollectorFactory *> *tablePropertiesCollectorFactories;
+
+#endif
+
 /** @brief If prefixExtractor is set and bloom_bits is not 0, create prefix bloom
  for memtable. If it is larger than 0.25, it is santinized to 0.25.
 
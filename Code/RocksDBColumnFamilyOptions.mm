@@ -13,6 +13,12 @@
 #import "RocksDBComparator.h"
 #import "RocksDBMergeOperator.h"
 #import "RocksDBPrefixExtractor.h"
+#import "RocksDBCompressionOptions.h"
+
+#if !defined(ROCKSDB_LITE)
+#import "RocksDBTablePropertiesCollectorFactory.h"
+#import <rocksdb/table_properties.h>
+#endif
 
 #import <rocksdb/options.h>
 #import <rocksdb/comparator.h>
@@ -35,6 +41,10 @@
 @property (nonatomic, assign) const rocksdb::SliceTransform *sliceTransform;
 @end
 
+@interface RocksDBCompressionOptions ()
+- (instancetype)initWithOptions:(rocksdb::CompressionOptions *)options owner:(id)owner;
+@end
+
 @interface RocksDBMemTableRepFactory ()
 @property (nonatomic, assign) rocksdb::MemTableRepFactory *memTableRepFactory;
 @end
@@ -43,6 +53,12 @@
 @property (nonatomic, assign) rocksdb::TableFactory *tableFactory;
 @end
 
+#if !defined(ROCKSDB_LITE)
+@interface RocksDBTablePropertiesCollectorFactory ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> collectorFactory;
+@end
+#endif
+
 @interface RocksDBColumnFamilyOptions ()
 {
 	rocksdb::ColumnFamilyOptions _options;
@@ -53,6 +69,10 @@
 
 	RocksDBMemTableRepFactory *_memTableRepFactoryWrapper;
 	RocksDBTableFactory *_tableFactoryWrapper;
+
+#if !defined(ROCKSDB_LITE)
+	NSArray<RocksDBTablePropertiesCollectorFactory *> *_tablePropertiesCollectorFactoryWrappers;
+#endif
 }
 @property (nonatomic, assign) rocksdb::ColumnFamilyOptions options;
 @end
@@ -135,6 +155,43 @@
 	_options.compression = (rocksdb::CompressionType)compressionType;
 }
 
+- (NSArray<NSNumber *> *)compressionPerLevel
+{
+	NSMutableArray *compressionPerLevel = [NSMutableArray arrayWithCapacity:_options.compression_per_level.size()];
+	for (auto compression : _options.compression_per_level) {
+		[compressionPerLevel addObject:@((RocksDBCompressionType)compression)];
+	}
+	return compressionPerLevel;
+}
+
+- (void)setCompressionPerLevel:(NSArray<NSNumber *> *)compressionPerLevel
+{
+	_options.compression_per_level.clear();
+	for (NSNumber *compression in compressionPerLevel) {
+		_options.compression_per_level.push_back((rocksdb::CompressionType)compression.charValue);
+	}
+}
+
+- (RocksDBCompressionType)bottommostCompressionType
+{
+	return (RocksDBCompressionType)_options.bottommost_compression;
+}
+
+- (void)setBottommostCompressionType:(RocksDBCompressionType)bottommostCompressionType
+{
+	_options.bottommost_compression = (rocksdb::CompressionType)bottommostCompressionType;
+}
+
+- (RocksDBCompressionOptions *)compressionOptions
+{
+	return [[RocksDBCompressionOptions alloc] initWithOptions:&_options.compression_opts owner:self];
+}
+
+- (RocksDBCompressionOptions *)bottommostCompressionOptions
+{
+	return [[RocksDBCompressionOptions alloc] initWithOptions:&_options.bottommost_compression_opts owner:self];
+}
+
 - (void)setCompactionStyle:(RocksDBCompactionStyle)compactionStyle
 {
 	_options.compaction_style = (rocksdb::CompactionStyle)compactionStyle;
@@ -288,6 +345,24 @@
 	return _tableFactoryWrapper;
 }
 
+#if !defined(ROCKSDB_LITE)
+
+- (void)setTablePropertiesCollectorFactories:(NSArray<RocksDBTablePropertiesCollectorFactory *> *)tablePropertiesCollectorFactories
+{
+	_tablePropertiesCollectorFactoryWrappers = [tablePropertiesCollectorFactories copy];
+	_options.table_properties_collector_factories.clear();
+	for (RocksDBTablePropertiesCollectorFactory *factory in _tablePropertiesCollectorFactoryWrappers) {
+		_options.table_properties_collector_factories.push_back(factory.collectorFactory);
+	}
+}
+
+- (NSArray<RocksDBTablePropertiesCollectorFactory *> *)tablePropertiesCollectorFactories
+{
+	return _tablePropertiesCollectorFactoryWrappers ?: @[];
+}
+
+#endif
+
 - (void)setMemtablePrefixBloomSizeRatio:(double)memtablePrefixBloomSizeRatio
 {
 	_options.memtable_prefix_bloom_size_ratio = memtablePrefixBloomSizeRatio;
@@ -10,6 +10,10 @@
 
 #import "RocksDBSlice.h"
 
+#if !defined(ROCKSDB_LITE)
+#import "RocksDBInvocationStatistics.h"
+#endif
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -56,6 +60,20 @@ typedef NS_ENUM(NSUInteger, RocksDBComparatorType)
 - (instancetype)initWithName:(NSString *)name
 					andBlock:(int (^)(RocksDBSlice *key1, RocksDBSlice *key2))block;
 
+#if !defined(ROCKSDB_LITE)
+
+/**
+ Statistics recording the invocations of, and the time spent in, the comparator block, split by
+ foreground and background calling context. Defaults to `nil`, which disables the instrumentation.
+
+ @discussion Set this before opening the database. Native comparators have no block and record nothing.
+
+ @warning Not available in RocksDB Lite.
+ */
+@property (nonatomic, strong, nullable) RocksDBInvocationStatistics *callbackStatistics;
+
+#endif
+
 @end
 
 NS_ASSUME_NONNULL_END
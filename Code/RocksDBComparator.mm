@@ -10,6 +10,10 @@
 #import "RocksDBSlice+Private.h"
 #import "RocksDBCallbackComparator.h"
 
+#if !defined(ROCKSDB_LITE)
+#import "RocksDBInvocationStatistics+Private.h"
+#endif
+
 #import <rocksdb/comparator.h>
 #include <rocksdb/slice.h>
 
@@ -18,6 +22,9 @@
 	NSString *_name;
 	int (^_comparatorBlock)(RocksDBSlice *key1, RocksDBSlice *key2);
 	const rocksdb::Comparator *_comparator;
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *_callbackStatistics;
+#endif
 }
 @property (nonatomic, strong) NSString *name;
 @property (nonatomic, assign) const rocksdb::Comparator *comparator;
@@ -26,6 +33,9 @@
 @implementation RocksDBComparator
 @synthesize name = _name;
 @synthesize comparator = _comparator;
+#if !defined(ROCKSDB_LITE)
+@synthesize callbackStatistics = _callbackStatistics;
+#endif
 
 #pragma mark - Comparator Factory
 
@@ -85,6 +95,15 @@
 {
 	RocksDBSlice *key1 = [[RocksDBSlice alloc] initWithSlice:const_cast<rocksdb::Slice*>(&slice1)];
 	RocksDBSlice *key2 = [[RocksDBSlice alloc] initWithSlice:const_cast<rocksdb::Slice*>(&slice2)];
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *statistics = _callbackStatistics;
+	if (statistics != nil && _comparatorBlock) {
+		uint64_t start = RocksDBCallbackNowNanos();
+		int result = _comparatorBlock(key1, key2);
+		[statistics recordNanos:RocksDBCallbackNowNanos() - start];
+		return result;
+	}
+#endif
 	return _comparatorBlock ? _comparatorBlock(key1, key2) : 0;
 }
 
@@ -0,0 +1,71 @@
+//
+//  RocksDBCompressionOptions.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Options to fine-tune the compression algorithms of a Column Family. Changes are applied
+ directly to the Column Family options this object was obtained from.
+
+ @see RocksDBColumnFamilyOptions
+ */
+@interface RocksDBCompressionOptions : NSObject
+
+/** @brief Zlib only: the window bits.
+ Default: -14
+ */
+@property (nonatomic, assign) int windowBits;
+
+/** @brief The compression level, interpreted by the selected algorithm.
+ Default: 32767 (the default level of each algorithm)
+ */
+@property (nonatomic, assign) int level;
+
+/** @brief Zlib only: the compression strategy.
+ Default: 0
+ */
+@property (nonatomic, assign) int strategy;
+
+/** @brief The maximum size of the dictionary used to prime the compression library.
+ Dictionaries are sampled from the data of each SST file and stored in the file. 0 disables
+ dictionary compression. Supported by ZSTD, Zlib and LZ4.
+ Default: 0
+ */
+@property (nonatomic, assign) uint32_t maxDictBytes;
+
+/** @brief ZSTD only: the maximum size of the training data passed to the ZSTD dictionary
+ trainer. When greater than 0 the dictionary is trained, rather than sampled, which
+ usually yields a much better compression ratio for small values. Typically 100x `maxDictBytes`.
+ Default: 0
+ */
+@property (nonatomic, assign) uint32_t zstdMaxTrainBytes;
+
+/** @brief The number of threads used to compress the blocks of a single SST file in parallel.
+ Default: 1
+ */
+@property (nonatomic, assign) uint32_t parallelThreads;
+
+/** @brief The upper bound on the data buffered while sampling the dictionary, 0 for no limit.
+ Default: 0
+ */
+@property (nonatomic, assign) uint64_t maxDictBufferBytes;
+
+/** @brief ZSTD only: use the ZSTD trainer when `zstdMaxTrainBytes` is set; otherwise the
+ faster ZDICT_finalizeDictionary API is used.
+ Default: true
+ */
+@property (nonatomic, assign) BOOL useZstdDictTrainer;
+
+/** @brief Only used for the bottommost compression options: these options take effect
+ only when enabled, otherwise the regular compression options apply to the bottommost level.
+ Default: false
+ */
+@property (nonatomic, assign) BOOL enabled;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,124 @@
+//
+//  RocksDBCompressionOptions.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBCompressionOptions.h"
+
+#import <rocksdb/advanced_options.h>
+
+@interface RocksDBCompressionOptions ()
+{
+	// Keeps the options object owning the wrapped compression options alive
+	id _owner;
+	rocksdb::CompressionOptions *_options;
+}
+@end
+
+@implementation RocksDBCompressionOptions
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithOptions:(rocksdb::CompressionOptions *)options owner:(id)owner
+{
+	self = [super init];
+	if (self) {
+		_options = options;
+		_owner = owner;
+	}
+	return self;
+}
+
+#pragma mark - Accessors
+
+- (int)windowBits
+{
+	return _options->window_bits;
+}
+
+- (void)setWindowBits:(int)windowBits
+{
+	_options->window_bits = windowBits;
+}
+
+- (int)level
+{
+	return _options->level;
+}
+
+- (void)setLevel:(int)level
+{
+	_options->level = level;
+}
+
+- (int)strategy
+{
+	return _options->strategy;
+}
+
+- (void)setStrategy:(int)strategy
+{
+	_options->strategy = strategy;
+}
+
+- (uint32_t)maxDictBytes
+{
+	return _options->max_dict_bytes;
+}
+
+- (void)setMaxDictBytes:(uint32_t)maxDictBytes
+{
+	_options->max_dict_bytes = maxDictBytes;
+}
+
+- (uint32_t)zstdMaxTrainBytes
+{
+	return _options->zstd_max_train_bytes;
+}
+
+- (void)setZstdMaxTrainBytes:(uint32_t)zstdMaxTrainBytes
+{
+	_options->zstd_max_train_bytes = zstdMaxTrainBytes;
+}
+
+- (uint32_t)parallelThreads
+{
+	return _options->parallel_threads;
+}
+
+- (void)setParallelThreads:(uint32_t)parallelThreads
+{
+	_options->parallel_threads = parallelThreads;
+}
+
+- (uint64_t)maxDictBufferBytes
+{
+	return _options->max_dict_buffer_bytes;
+}
+
+- (void)setMaxDictBufferBytes:(uint64_t)maxDictBufferBytes
+{
+	_options->max_dict_buffer_bytes = maxDictBufferBytes;
+}
+
+- (BOOL)useZstdDictTrainer
+{
+	return _options->use_zstd_dict_trainer;
+}
+
+- (void)setUseZstdDictTrainer:(BOOL)useZstdDictTrainer
+{
+	_options->use_zstd_dict_trainer = useZstdDictTrainer;
+}
+
+- (BOOL)enabled
+{
+	return _options->enabled;
+}
+
+- (void)setEnabled:(BOOL)enabled
+{
+	_options->enabled = enabled;
+}
+
+@end
@@ -9,6 +9,8 @@
 #import <Foundation/Foundation.h>
 
 @class RocksDBEnv;
+@class RocksDBCache;
+@class RocksDBWriteBufferManager;
 
 #if !defined(ROCKSDB_LITE)
 @class RocksDBStatistics;
@@ -80,8 +82,63 @@ typedef NS_ENUM(unsigned char, RocksDBLogLevel)
  @see RocksDBStatistics
  */
 @property (nonatomic, strong, nullable) RocksDBStatistics *statistics;
+
+/** @brief If true, comparator, merge operator and prefix extractor callbacks are attributed to
+ the foreground or the background context in their `RocksDBInvocationStatistics`. This installs an
+ event listener that is notified of every flush and compaction. Without it all callbacks are
+ recorded in the foreground context.
+ The default is false.
+
+ @see RocksDBInvocationStatistics
+ */
+@property (nonatomic, assign) BOOL trackCallbackContext;
 #endif
 
+/** @brief If not zero, dump the DB statistics to the info log every statsDumpPeriodSec seconds.
+ The default is 600. */
+@property (nonatomic, assign) unsigned int statsDumpPeriodSec;
+
+/** @brief If not zero, snapshot the tickers of the DB statistics every statsPersistPeriodSec
+ seconds, and keep the changes in memory, or on disk if `persistStatsToDisk` is set.
+ The history can be read with `-[RocksDB statsHistoryFrom:to:error:]`.
+ The default is 600. */
+@property (nonatomic, assign) unsigned int statsPersistPeriodSec;
+
+/** @brief If true, the stats history is persisted to the hidden column family
+ "___rocksdb_stats_history___" of the DB, so that it survives restarts.
+ The default is false. */
+@property (nonatomic, assign) BOOL persistStatsToDisk;
+
+/** @brief The maximum memory used by the in-memory stats history, in bytes. The oldest
+ snapshots are dropped once the limit is reached.
+ The default is 1MB. */
+@property (nonatomic, assign) size_t statsHistoryBufferSize;
+
+/** @brief If true, the status of the threads involved in this DB is tracked and can be read
+ with `-[RocksDBEnv threadList]` or sampled with a `RocksDBOperationMonitor`.
+ The default is false. */
+@property (nonatomic, assign) BOOL enableThreadTracking;
+
+/** @brief A global cache for table-level rows, i.e. the results of point lookups.
+ Lookups that hit the row cache skip the index, filter and data block reads.
+ Hits and misses are reported via `RocksDBTickerRowCacheHit` and
+ `RocksDBTickerRowCacheMiss` when statistics are enabled.
+ The row cache must be an LRU cache, setting a HyperClockCache raises an `NSInvalidArgumentException`.
+ The default is nil (disabled).
+
+ @see RocksDBCache
+ */
+@property (nonatomic, strong, nullable) RocksDBCache *rowCache;
+
+/** @brief If non-nil, the memtable memory of all Column Families is accounted
+ against, and limited by, this manager. The same manager can be shared between
+ several DB instances to enforce a single memtable budget across them.
+ The default is nil.
+
+ @see RocksDBWriteBufferManager
+ */
+@property (nonatomic, strong, nullable) RocksDBWriteBufferManager *writeBufferManager;
+
 /** @brief If true, then every store to stable storage will issue a fsync.
  The default is false. */
 @property (nonatomic, assign) BOOL useFSync;
@@ -104,6 +161,15 @@ typedef NS_ENUM(unsigned char, RocksDBLogLevel)
  The default is 0. */
 @property (nonatomic, assign) uint64_t bytesPerSync;
 
+/** @brief Allows the OS to mmap files for reading SST tables.
+ Required by the PlainTable and Cuckoo table formats.
+ The default is false. */
+@property (nonatomic, assign) BOOL allowMmapReads;
+
+/** @brief Allows the OS to mmap files for writing.
+ The default is false. */
+@property (nonatomic, assign) BOOL allowMmapWrites;
+
 @end
 
 NS_ASSUME_NONNULL_END
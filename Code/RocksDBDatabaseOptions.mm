@@ -11,10 +11,26 @@
 #import "RocksDBEnv.h"
 #import "RocksDBEnv+Private.h"
 #import "RocksDBSnapshot.h"
+#import "RocksDBCache.h"
+#import "RocksDBWriteBufferManager.h"
 #import <rocksdb/options.h>
+#import <rocksdb/cache.h>
+#import <rocksdb/write_buffer_manager.h>
+
+#include <algorithm>
+
+@interface RocksDBCache ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::Cache> cache;
+@property (nonatomic, assign, readonly, getter=isHyperClockCache) BOOL hyperClockCache;
+@end
+
+@interface RocksDBWriteBufferManager ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::WriteBufferManager> writeBufferManager;
+@end
 
 #if !defined(ROCKSDB_LITE)
 #import "RocksDBStatistics.h"
+#import "RocksDBCallbackContextListener.h"
 @interface RocksDBStatistics ()
 @property (nonatomic, assign) std::shared_ptr<rocksdb::Statistics> statistics;
 @end
@@ -23,6 +39,8 @@
 @interface RocksDBDatabaseOptions ()
 {
 	rocksdb::DBOptions _options;
+	RocksDBCache *_rowCacheWrapper;
+	RocksDBWriteBufferManager *_writeBufferManagerWrapper;
 
 #if !defined(ROCKSDB_LITE)
 	RocksDBStatistics *_statisticsWrapper;
@@ -138,8 +156,48 @@
 	_statisticsWrapper = statistics;
 	_options.statistics = _statisticsWrapper.statistics;
 }
+
+- (BOOL)trackCallbackContext
+{
+	auto listener = RocksDBCallbackContextListener();
+	return std::find(_options.listeners.begin(), _options.listeners.end(), listener) != _options.listeners.end();
+}
+
+- (void)setTrackCallbackContext:(BOOL)trackCallbackContext
+{
+	auto listener = RocksDBCallbackContextListener();
+	_options.listeners.erase(std::remove(_options.listeners.begin(), _options.listeners.end(), listener), _options.listeners.end());
+	if (trackCallbackContext) {
+		_options.listeners.push_back(listener);
+	}
+}
 #endif
 
+- (RocksDBCache *)rowCache
+{
+	return _rowCacheWrapper;
+}
+
+- (void)setRowCache:(RocksDBCache *)rowCache
+{
+	if (rowCache.isHyperClockCache) {
+		[NSException raise:NSInvalidArgumentException format:@"The row cache must be an LRU cache, HyperClockCache is not supported"];
+	}
+	_rowCacheWrapper = rowCache;
+	_options.row_cache = _rowCacheWrapper.cache;
+}
+
+- (RocksDBWriteBufferManager *)writeBufferManager
+{
+	return _writeBufferManagerWrapper;
+}
+
+- (void)setWriteBufferManager:(RocksDBWriteBufferManager *)writeBufferManager
+{
+	_writeBufferManagerWrapper = writeBufferManager;
+	_options.write_buffer_manager = _writeBufferManagerWrapper.writeBufferManager;
+}
+
 - (BOOL)useFSync
 {
 	return _options.use_fsync;
@@ -190,4 +248,74 @@
 	_options.bytes_per_sync = bytesPerSync;
 }
 
+- (BOOL)allowMmapReads
+{
+	return _options.allow_mmap_reads;
+}
+
+- (void)setAllowMmapReads:(BOOL)allowMmapReads
+{
+	_options.allow_mmap_reads = allowMmapReads;
+}
+
+- (BOOL)allowMmapWrites
+{
+	return _options.allow_mmap_writes;
+}
+
+- (void)setAllowMmapWrites:(BOOL)allowMmapWrites
+{
+	_options.allow_mmap_writes = allowMmapWrites;
+}
+
+- (unsigned int)statsDumpPeriodSec
+{
+	return _options.stats_dump_period_sec;
+}
+
+- (void)setStatsDumpPeriodSec:(unsigned int)statsDumpPeriodSec
+{
+	_options.stats_dump_period_sec = statsDumpPeriodSec;
+}
+
+- (unsigned int)statsPersistPeriodSec
+{
+	return _options.stats_persist_period_sec;
+}
+
+- (void)setStatsPersistPeriodSec:(unsigned int)statsPersistPeriodSec
+{
+	_options.stats_persist_period_sec = statsPersistPeriodSec;
+}
+
+- (BOOL)persistStatsToDisk
+{
+	return _options.persist_stats_to_disk;
+}
+
+- (void)setPersistStatsToDisk:(BOOL)persistStatsToDisk
+{
+	_options.persist_stats_to_disk = persistStatsToDisk;
+}
+
+- (size_t)statsHistoryBufferSize
+{
+	return _options.stats_history_buffer_size;
+}
+
+- (void)setStatsHistoryBufferSize:(size_t)statsHistoryBufferSize
+{
+	_options.stats_history_buffer_size = statsHistoryBufferSize;
+}
+
+- (BOOL)enableThreadTracking
+{
+	return _options.enable_thread_tracking;
+}
+
+- (void)setEnableThreadTracking:(BOOL)enableThreadTracking
+{
+	_options.enable_thread_tracking = enableThreadTracking;
+}
+
 @end
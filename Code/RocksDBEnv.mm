@@ -10,6 +10,7 @@
 
 #if ROCKSDB_USING_THREAD_STATUS
 #import "RocksDBThreadStatus.h"
+#import "RocksDBThreadStatus+Private.h"
 #endif
 
 #import <rocksdb/env.h>
@@ -24,17 +25,6 @@
 @property (nonatomic, assign) rocksdb::Env *env;
 @end
 
-#if ROCKSDB_USING_THREAD_STATUS
-@interface RocksDBThreadStatus ()
-@property (nonatomic, assign) uint64_t threadId;
-@property (nonatomic, assign) RocksDBThreadType threadType;
-@property (nonatomic, copy) NSString *databaseName;
-@property (nonatomic, copy) NSString *columnFamilyname;
-@property (nonatomic, assign) RocksDBOperationType operationType;
-@property (nonatomic, assign) RocksDBStateType stateType;
-@end
-#endif
-
 #pragma mark - Impl
 
 @implementation RocksDBEnv
@@ -133,13 +123,7 @@
 
 	NSMutableArray *threadList = [NSMutableArray array];
 	for (auto it = std::begin(thread_list); it != std::end(thread_list); ++it) {
-		RocksDBThreadStatus *thread = [RocksDBThreadStatus new];
-		thread.threadId = (*it).thread_id;
-		thread.threadType  = (RocksDBThreadType)(*it).thread_type;
-		thread.databaseName = [NSString stringWithCString:(*it).db_name.c_str() encoding:NSUTF8StringEncoding];
-		thread.columnFamilyname = [NSString stringWithCString:(*it).cf_name.c_str() encoding:NSUTF8StringEncoding];
-		thread.operationType = (RocksDBOperationType)(*it).operation_type;
-		thread.stateType = (RocksDBStateType)(*it).state_type;
+		RocksDBThreadStatus *thread = [[RocksDBThreadStatus alloc] initWithThreadStatus:*it];
 		[threadList addObject:thread];
 	}
 
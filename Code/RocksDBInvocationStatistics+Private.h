@@ -0,0 +1,27 @@
+//
+//  RocksDBInvocationStatistics+Private.h
+//  ObjectiveRocks
+//
+
+#import "RocksDBInvocationStatistics.h"
+
+#include <chrono>
+
+/** @brief Returns a monotonic timestamp in nanoseconds used to time callback invocations. */
+static inline uint64_t RocksDBCallbackNowNanos()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ This category is intended to hide all C++ types from the public interface in order to
+ maintain a pure Objective-C API for Swift compatibility.
+ */
+@interface RocksDBInvocationStatistics (Private)
+
+/**
+ Records an invocation that took the given nanoseconds, attributed to the context of the calling thread.
+ */
+- (void)recordNanos:(uint64_t)nanos;
+
+@end
@@ -0,0 +1,64 @@
+//
+//  RocksDBInvocationStatistics.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+#import "RocksDBStatisticsHistogram.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** @brief The context in which RocksDB invoked a callback. */
+typedef NS_ENUM(NSUInteger, RocksDBInvocationContext)
+{
+	/** @brief Invoked on a thread serving reads or writes, e.g. a Get, an iterator or a memtable insert. */
+	RocksDBInvocationContextForeground,
+
+	/** @brief Invoked on a background thread running a flush or a compaction. */
+	RocksDBInvocationContextBackground
+};
+
+/**
+ Records the number of invocations of, and the time spent in, the blocks of a `RocksDBComparator`,
+ `RocksDBMergeOperator` or `RocksDBPrefixExtractor`, split by the context of the invocation.
+
+ @discussion Invocations are attributed to the background context while the calling thread runs a
+ flush or a compaction. This requires `trackCallbackContext` to be enabled in the database options,
+ otherwise all invocations are recorded in the foreground context. Flushes done while recovering the
+ write-ahead log on open run on the opening thread and are attributed to the foreground.
+
+ All durations are in nanoseconds. Recording is thread-safe.
+ */
+@interface RocksDBInvocationStatistics : NSObject
+
+/**
+ Returns the number of recorded invocations in the given context.
+
+ @param context The calling context.
+ @return The number of invocations.
+ */
+- (uint64_t)invocationCountInContext:(RocksDBInvocationContext)context;
+
+/**
+ Returns the total time in nanoseconds spent in the callback blocks in the given context.
+
+ @param context The calling context.
+ @return The total time in nanoseconds.
+ */
+- (uint64_t)totalNanosInContext:(RocksDBInvocationContext)context;
+
+/**
+ Returns the histogram of the time in nanoseconds spent per invocation in the given context.
+
+ @param context The calling context.
+ @return A snapshot of the histogram.
+ */
+- (RocksDBStatisticsHistogram *)histogramInContext:(RocksDBInvocationContext)context;
+
+/** @brief Clears all recorded invocations. */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,75 @@
+//
+//  RocksDBInvocationStatistics.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBInvocationStatistics.h"
+#import "RocksDBInvocationStatistics+Private.h"
+#import "RocksDBStatisticsHistogram+Private.h"
+#import "RocksDBCallbackContextListener.h"
+
+#import <rocksdb/statistics.h>
+#import <monitoring/histogram.h>
+#import <util/core_local.h>
+
+@interface RocksDBInvocationStatistics ()
+{
+	// Per-core histograms, like rocksdb::StatisticsImpl, so that concurrent
+	// callbacks on different threads don't contend on the same counters.
+	rocksdb::CoreLocalArray<rocksdb::HistogramImpl> _histograms[2];
+}
+@end
+
+@implementation RocksDBInvocationStatistics
+
+#pragma mark - Recording
+
+- (void)recordNanos:(uint64_t)nanos
+{
+	RocksDBInvocationContext context = RocksDBIsBackgroundCallbackThread() ? RocksDBInvocationContextBackground : RocksDBInvocationContextForeground;
+	_histograms[context].Access()->Add(nanos);
+}
+
+#pragma mark - Accessors
+
+- (void)histogramData:(rocksdb::HistogramData *)data inContext:(RocksDBInvocationContext)context
+{
+	rocksdb::HistogramImpl merged;
+	for (size_t core = 0; core < _histograms[context].Size(); ++core) {
+		merged.Merge(*_histograms[context].AccessAtCore(core));
+	}
+	merged.Data(data);
+}
+
+- (uint64_t)invocationCountInContext:(RocksDBInvocationContext)context
+{
+	rocksdb::HistogramData data;
+	[self histogramData:&data inContext:context];
+	return data.count;
+}
+
+- (uint64_t)totalNanosInContext:(RocksDBInvocationContext)context
+{
+	rocksdb::HistogramData data;
+	[self histogramData:&data inContext:context];
+	return data.sum;
+}
+
+- (RocksDBStatisticsHistogram *)histogramInContext:(RocksDBInvocationContext)context
+{
+	rocksdb::HistogramData data;
+	[self histogramData:&data inContext:context];
+	NSString *name = context == RocksDBInvocationContextBackground ? @"callback.background.nanos" : @"callback.foreground.nanos";
+	return [[RocksDBStatisticsHistogram alloc] initWithHistogramData:data name:name];
+}
+
+- (void)reset
+{
+	for (auto &histograms : _histograms) {
+		for (size_t core = 0; core < histograms.Size(); ++core) {
+			histograms.AccessAtCore(core)->Clear();
+		}
+	}
+}
+
+@end
@@ -0,0 +1,12 @@
+//
+//  RocksDBMemTableStats+Private.h
+//  ObjectiveRocks
+//
+
+#import "RocksDBMemTableStats.h"
+
+@interface RocksDBMemTableStats (Private)
+
+- (instancetype)initWithCount:(uint64_t)count size:(uint64_t)size;
+
+@end
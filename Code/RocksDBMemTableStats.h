@@ -0,0 +1,24 @@
+//
+//  RocksDBMemTableStats.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The approximate number of entries and size of the data in the mem tables of a
+ Column Family that fall within a key range.
+ */
+@interface RocksDBMemTableStats : NSObject
+
+/** @brief The approximate number of entries in the range. */
+@property (nonatomic, assign, readonly) uint64_t count;
+
+/** @brief The approximate size in bytes of the entries in the range. */
+@property (nonatomic, assign, readonly) uint64_t size;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,25 @@
+//
+//  RocksDBMemTableStats.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBMemTableStats.h"
+
+@implementation RocksDBMemTableStats
+
+- (instancetype)initWithCount:(uint64_t)count size:(uint64_t)size
+{
+	self = [super init];
+	if (self) {
+		_count = count;
+		_size = size;
+	}
+	return self;
+}
+
+- (NSString *)description
+{
+	return [NSString stringWithFormat:@"<%@: %p, count: %llu, size: %llu>", NSStringFromClass(self.class), self, self.count, self.size];
+}
+
+@end
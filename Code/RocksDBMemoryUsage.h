@@ -0,0 +1,96 @@
+//
+//  RocksDBMemoryUsage.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+#import "RocksDB.h"
+#import "RocksDBCache.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDBDatabaseMemoryUsage;
+@class RocksDBColumnFamilyMemoryUsage;
+
+/**
+ The approximate memory usage of a set of DB instances and caches, e.g. all the DBs in
+ the process.
+
+ @discussion The totals are computed via rocksdb::MemoryUtil, the per-DB and per-Column
+ Family breakdowns via the `rocksdb.size-all-mem-tables`, `rocksdb.cur-size-all-mem-tables`
+ and `rocksdb.estimate-table-readers-mem` properties.
+ */
+@interface RocksDBMemoryUsage : NSObject
+
+/**
+ Computes the approximate memory usage of the given DB instances and caches.
+
+ @param databases The DB instances to include. Passing a closed DB is an error.
+ @param caches The caches to include. Caches shared between several DBs or passed
+ several times are only counted once.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The memory usage, nil on error.
+ */
++ (nullable instancetype)memoryUsageForDatabases:(NSArray<RocksDB *> *)databases
+										  caches:(nullable NSArray<RocksDBCache *> *)caches
+										   error:(NSError * __autoreleasing *)error;
+
+/** @brief The total memory used by the memtables, including the flushed memtables pinned by iterators. */
+@property (nonatomic, readonly) uint64_t memTableTotal;
+
+/** @brief The memory used by the memtables that are not yet flushed. */
+@property (nonatomic, readonly) uint64_t memTableUnflushed;
+
+/** @brief The memory used by the table readers, excluding the blocks held in the block cache. */
+@property (nonatomic, readonly) uint64_t tableReadersTotal;
+
+/** @brief The memory used by the given caches. */
+@property (nonatomic, readonly) uint64_t cacheTotal;
+
+/** @brief The breakdown per DB instance, in the order the DBs were given. */
+@property (nonatomic, strong, readonly) NSArray<RocksDBDatabaseMemoryUsage *> *databases;
+
+@end
+
+/**
+ The approximate memory usage of a single DB instance.
+ */
+@interface RocksDBDatabaseMemoryUsage : NSObject
+
+/** @brief The name, i.e. the path, of the DB. */
+@property (nonatomic, copy, readonly) NSString *name;
+
+/** @brief The total memory used by the memtables of all Column Families. */
+@property (nonatomic, readonly) uint64_t memTableTotal;
+
+/** @brief The memory used by the unflushed memtables of all Column Families. */
+@property (nonatomic, readonly) uint64_t memTableUnflushed;
+
+/** @brief The memory used by the table readers of all Column Families. */
+@property (nonatomic, readonly) uint64_t tableReadersTotal;
+
+/** @brief The breakdown per Column Family. */
+@property (nonatomic, strong, readonly) NSArray<RocksDBColumnFamilyMemoryUsage *> *columnFamilies;
+
+@end
+
+/**
+ The approximate memory usage of a single Column Family.
+ */
+@interface RocksDBColumnFamilyMemoryUsage : NSObject
+
+/** @brief The name of the Column Family. */
+@property (nonatomic, copy, readonly) NSString *name;
+
+/** @brief The value of the `rocksdb.size-all-mem-tables` property. */
+@property (nonatomic, readonly) uint64_t memTableTotal;
+
+/** @brief The value of the `rocksdb.cur-size-all-mem-tables` property. */
+@property (nonatomic, readonly) uint64_t memTableUnflushed;
+
+/** @brief The value of the `rocksdb.estimate-table-readers-mem` property. */
+@property (nonatomic, readonly) uint64_t tableReadersTotal;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,123 @@
+//
+//  RocksDBMemoryUsage.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBMemoryUsage.h"
+#import "RocksDB+Private.h"
+#import "RocksDBColumnFamilyHandle+Private.h"
+#import "RocksDBError.h"
+
+#import <rocksdb/db.h>
+#import <rocksdb/cache.h>
+#import <rocksdb/utilities/memory_util.h>
+
+#include <unordered_set>
+
+@interface RocksDBCache ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::Cache> cache;
+@end
+
+@interface RocksDBColumnFamilyMemoryUsage ()
+- (instancetype)initWithDatabase:(rocksdb::DB *)db columnFamily:(rocksdb::ColumnFamilyHandle *)columnFamily;
+@end
+
+@interface RocksDBDatabaseMemoryUsage ()
+- (instancetype)initWithDatabase:(RocksDB *)database;
+@end
+
+@implementation RocksDBMemoryUsage
+
++ (instancetype)memoryUsageForDatabases:(NSArray<RocksDB *> *)databases
+								 caches:(NSArray<RocksDBCache *> *)caches
+								  error:(NSError * __autoreleasing *)error
+{
+	std::vector<rocksdb::DB *> dbs;
+	for (RocksDB *database in databases) {
+		if (database.isClosed) {
+			NSError *temp = [RocksDBError errorWithRocksStatus:rocksdb::Status::InvalidArgument("Database is closed")];
+			if (error && *error == nil) {
+				*error = temp;
+			}
+			return nil;
+		}
+		dbs.push_back(database.db);
+	}
+
+	std::unordered_set<const rocksdb::Cache *> cacheSet;
+	for (RocksDBCache *cache in caches) {
+		cacheSet.insert(cache.cache.get());
+	}
+
+	std::map<rocksdb::MemoryUtil::UsageType, uint64_t> usage;
+	rocksdb::Status status = rocksdb::MemoryUtil::GetApproximateMemoryUsageByType(dbs, cacheSet, &usage);
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+
+	RocksDBMemoryUsage *instance = [RocksDBMemoryUsage new];
+	instance->_memTableTotal = usage[rocksdb::MemoryUtil::kMemTableTotal];
+	instance->_memTableUnflushed = usage[rocksdb::MemoryUtil::kMemTableUnFlushed];
+	instance->_tableReadersTotal = usage[rocksdb::MemoryUtil::kTableReadersTotal];
+	instance->_cacheTotal = usage[rocksdb::MemoryUtil::kCacheTotal];
+
+	NSMutableArray *breakdown = [NSMutableArray arrayWithCapacity:databases.count];
+	for (RocksDB *database in databases) {
+		[breakdown addObject:[[RocksDBDatabaseMemoryUsage alloc] initWithDatabase:database]];
+	}
+	instance->_databases = breakdown;
+
+	return instance;
+}
+
+@end
+
+@implementation RocksDBDatabaseMemoryUsage
+
+- (instancetype)initWithDatabase:(RocksDB *)database
+{
+	self = [super init];
+	if (self) {
+		rocksdb::DB *db = database.db;
+		self->_name = [NSString stringWithUTF8String:db->GetName().c_str()];
+
+		NSArray<RocksDBColumnFamilyHandle *> *handles = database.columnFamilies;
+		if (handles.count == 0) {
+			handles = @[database.columnFamily];
+		}
+
+		NSMutableArray *columnFamilies = [NSMutableArray arrayWithCapacity:handles.count];
+		for (RocksDBColumnFamilyHandle *handle in handles) {
+			RocksDBColumnFamilyMemoryUsage *usage = [[RocksDBColumnFamilyMemoryUsage alloc] initWithDatabase:db
+																								columnFamily:handle.columnFamily];
+			self->_memTableTotal += usage.memTableTotal;
+			self->_memTableUnflushed += usage.memTableUnflushed;
+			self->_tableReadersTotal += usage.tableReadersTotal;
+			[columnFamilies addObject:usage];
+		}
+		self->_columnFamilies = columnFamilies;
+	}
+	return self;
+}
+
+@end
+
+@implementation RocksDBColumnFamilyMemoryUsage
+
+- (instancetype)initWithDatabase:(rocksdb::DB *)db columnFamily:(rocksdb::ColumnFamilyHandle *)columnFamily
+{
+	self = [super init];
+	if (self) {
+		self->_name = [NSString stringWithUTF8String:columnFamily->GetName().c_str()];
+		db->GetIntProperty(columnFamily, rocksdb::DB::Properties::kSizeAllMemTables, &self->_memTableTotal);
+		db->GetIntProperty(columnFamily, rocksdb::DB::Properties::kCurSizeAllMemTables, &self->_memTableUnflushed);
+		db->GetIntProperty(columnFamily, rocksdb::DB::Properties::kEstimateTableReadersMem, &self->_tableReadersTotal);
+	}
+	return self;
+}
+
+@end
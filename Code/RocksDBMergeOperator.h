@@ -8,6 +8,10 @@
 
 #import <Foundation/Foundation.h>
 
+#if !defined(ROCKSDB_LITE)
+#import "RocksDBInvocationStatistics.h"
+#endif
+
 NS_ASSUME_NONNULL_BEGIN
 
 /** 
@@ -56,6 +60,20 @@ NS_ASSUME_NONNULL_BEGIN
 			   partialMergeBlock:(NSData * _Nullable (^)(NSData * key, NSData *leftOperand, NSData *rightOperand))partialMergeBlock
 				  fullMergeBlock:(NSData * _Nullable (^)(NSData * key, NSData * _Nullable existingValue, NSArray<NSData *> *operandList))fullMergeBlock;
 
+#if !defined(ROCKSDB_LITE)
+
+/**
+ Statistics recording the invocations of, and the time spent in, the merge blocks, split by
+ foreground and background calling context. Defaults to `nil`, which disables the instrumentation.
+
+ @discussion Set this before opening the database. Partial and full merges are recorded together.
+
+ @warning Not available in RocksDB Lite.
+ */
+@property (nonatomic, strong, nullable) RocksDBInvocationStatistics *callbackStatistics;
+
+#endif
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -11,6 +11,10 @@
 #import "RocksDBCallbackAssociativeMergeOperator.h"
 #import "RocksDBCallbackMergeOperator.h"
 
+#if !defined(ROCKSDB_LITE)
+#import "RocksDBInvocationStatistics+Private.h"
+#endif
+
 #import <rocksdb/slice.h>
 #import <rocksdb/env.h>
 
@@ -20,6 +24,9 @@
 {
 	NSString *_name;
 	rocksdb::MergeOperator *_mergeOperator;
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *_callbackStatistics;
+#endif
 }
 @property (nonatomic, copy) NSString *name;
 @property (nonatomic, assign) rocksdb::MergeOperator *mergeOperator;
@@ -69,6 +76,16 @@ bool trampoline(void* instance,
 	NSData *previous = (existingSlice == nullptr) ? nil : DataFromSlice(*existingSlice);
 	NSData *value = DataFromSlice(valueSlice);
 
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *statistics = self.callbackStatistics;
+	if (statistics != nil && _associativeMergeBlock) {
+		uint64_t start = RocksDBCallbackNowNanos();
+		NSData *mergeResult = _associativeMergeBlock(key, previous, value);
+		[statistics recordNanos:RocksDBCallbackNowNanos() - start];
+		return mergeResult;
+	}
+#endif
+
 	NSData *mergeResult = _associativeMergeBlock ? _associativeMergeBlock(key, previous, value): nil;
 	return mergeResult;
 }
@@ -126,6 +143,16 @@ bool trampolinePartialMerge(void* instance,
 	NSData *left = DataFromSlice(leftSlice);
 	NSData *right = DataFromSlice(rightSlice);
 
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *statistics = self.callbackStatistics;
+	if (statistics != nil && _partialMergeBlock) {
+		uint64_t start = RocksDBCallbackNowNanos();
+		NSData *mergeResult = _partialMergeBlock(key, left, right);
+		[statistics recordNanos:RocksDBCallbackNowNanos() - start];
+		return mergeResult;
+	}
+#endif
+
 	NSData *mergeResult = _partialMergeBlock ? _partialMergeBlock(key, left, right): nil;
 	return mergeResult;
 }
@@ -165,6 +192,16 @@ bool trampolineFullMerge(void* instance,
 		}
 	}
 
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *statistics = self.callbackStatistics;
+	if (statistics != nil && _fullMergeBlock) {
+		uint64_t start = RocksDBCallbackNowNanos();
+		NSData *mergeResult = _fullMergeBlock(key, previous, operands);
+		[statistics recordNanos:RocksDBCallbackNowNanos() - start];
+		return mergeResult;
+	}
+#endif
+
 	NSData *mergeResult = _fullMergeBlock ? _fullMergeBlock(key, previous, operands) : nil;
 	return mergeResult;
 }
@@ -176,6 +213,9 @@ bool trampolineFullMerge(void* instance,
 @implementation RocksDBMergeOperator
 @synthesize name = _name;
 @synthesize mergeOperator = _mergeOperator;
+#if !defined(ROCKSDB_LITE)
+@synthesize callbackStatistics = _callbackStatistics;
+#endif
 
 + (instancetype)operatorWithName:(NSString *)name andBlock:(NSData * (^)(NSData *, NSData *, NSData *))block
 {
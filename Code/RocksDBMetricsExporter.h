@@ -0,0 +1,100 @@
+//
+//  RocksDBMetricsExporter.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDB;
+@class RocksDBStatistics;
+
+/** @brief The text format of the exported metrics. */
+typedef NS_ENUM(NSUInteger, RocksDBMetricsFormat)
+{
+	/** @brief OpenMetrics 1.0 text format, terminated by `# EOF`. */
+	RocksDBMetricsFormatOpenMetrics,
+	/** @brief Prometheus 0.0.4 text exposition format. */
+	RocksDBMetricsFormatPrometheus
+};
+
+/**
+ Renders the tickers and histograms of a `RocksDBStatistics` and integer properties of the
+ column families of a set of databases in the OpenMetrics or Prometheus text format.
+
+ Metric names are derived from the RocksDB names by replacing every character that is not
+ alphanumeric with an underscore, e.g. the ticker "rocksdb.block.cache.miss" is exported as the
+ counter `rocksdb_block_cache_miss_total`. Histograms are exported as summaries with the
+ quantiles 0.5, 0.95, 0.99 and 1. Properties are exported as gauges with the `db` and `cf` labels.
+
+ @see RocksDBStatistics
+ */
+@interface RocksDBMetricsExporter : NSObject
+
+/**
+ Initializes a new exporter.
+
+ @param statistics The statistics to export, or nil to only export properties.
+ @return A newly-initialized exporter.
+ */
+- (instancetype)initWithStatistics:(nullable RocksDBStatistics *)statistics;
+
+/** @brief The statistics to export. */
+@property (nonatomic, strong, readonly, nullable) RocksDBStatistics *statistics;
+
+/** @brief The text format. The default is `RocksDBMetricsFormatOpenMetrics`. */
+@property (nonatomic, assign) RocksDBMetricsFormat format;
+
+/** @brief Labels added to every exported sample, e.g. the instance. The default is empty. */
+@property (nonatomic, copy) NSDictionary<NSString *, NSString *> *labels;
+
+/**
+ @brief The integer properties exported for each column family. The default is
+ `defaultIntProperties`.
+
+ @see -[RocksDB valueForIntProperty:inColumnFamily:]
+ */
+@property (nonatomic, copy) NSArray<NSString *> *intProperties;
+
+/**
+ The default integer properties: pending compaction bytes, memtable sizes, SST file sizes,
+ running flushes and compactions, estimated keys and table reader memory, and write stall state.
+ */
++ (NSArray<NSString *> *)defaultIntProperties;
+
+/**
+ Adds a database whose column family properties should be exported. The exporter doesn't
+ retain the database, and skips it once it is closed.
+
+ @param database The database to export.
+ @param name The value of the `db` label of the samples of this database.
+ */
+- (void)addDatabase:(RocksDB *)database withName:(NSString *)name;
+
+/**
+ Removes a database added with `addDatabase:withName:`.
+
+ @param database The database to remove.
+ */
+- (void)removeDatabase:(RocksDB *)database;
+
+/**
+ Renders all metrics.
+
+ @return The UTF-8 encoded metrics text.
+ */
+- (NSData *)exportMetrics;
+
+/**
+ Renders all metrics and writes them to the given file descriptor.
+
+ @param fileDescriptor The file descriptor to write to.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return True if the metrics were written completely.
+ */
+- (BOOL)writeToFileDescriptor:(int)fileDescriptor error:(NSError * _Nullable *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
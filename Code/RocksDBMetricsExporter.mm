@@ -0,0 +1,297 @@
+//
+//  RocksDBMetricsExporter.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBMetricsExporter.h"
+#import "RocksDB+Private.h"
+#import "RocksDBColumnFamilyHandle+Private.h"
+#import "RocksDBStatistics.h"
+#import "RocksDBError.h"
+
+#import <rocksdb/db.h>
+#import <rocksdb/statistics.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <errno.h>
+
+@interface RocksDBStatistics ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::Statistics> statistics;
+@end
+
+static std::string MetricName(const std::string &name)
+{
+	std::string metric = name;
+	for (char &c : metric) {
+		if (!isalnum((unsigned char)c)) {
+			c = '_';
+		}
+	}
+	return metric;
+}
+
+static void AppendLabelValue(std::string *dst, const std::string &value)
+{
+	for (char c : value) {
+		switch (c) {
+			case '\\':
+				dst->append("\\\\");
+				break;
+			case '"':
+				dst->append("\\\"");
+				break;
+			case '\n':
+				dst->append("\\n");
+				break;
+			default:
+				dst->push_back(c);
+		}
+	}
+}
+
+/// Appends `{label="value",...}` with the given extra label, or nothing if there are no labels.
+static void AppendLabels(std::string *dst, const std::string &labels, const char *extraName = nullptr, const std::string &extraValue = "")
+{
+	if (labels.empty() && extraName == nullptr) {
+		return;
+	}
+
+	dst->push_back('{');
+	dst->append(labels);
+	if (extraName != nullptr) {
+		if (!labels.empty()) {
+			dst->push_back(',');
+		}
+		dst->append(extraName);
+		dst->append("=\"");
+		AppendLabelValue(dst, extraValue);
+		dst->push_back('"');
+	}
+	dst->push_back('}');
+}
+
+static void AppendValue(std::string *dst, double value)
+{
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), " %.17g\n", value);
+	dst->append(buffer);
+}
+
+static void AppendValue(std::string *dst, uint64_t value)
+{
+	dst->push_back(' ');
+	dst->append(std::to_string(value));
+	dst->push_back('\n');
+}
+
+@interface RocksDBMetricsExporter ()
+{
+	NSMapTable<RocksDB *, NSString *> *_databases;
+}
+@end
+
+@implementation RocksDBMetricsExporter
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithStatistics:(RocksDBStatistics *)statistics
+{
+	self = [super init];
+	if (self) {
+		_statistics = statistics;
+		_format = RocksDBMetricsFormatOpenMetrics;
+		_labels = @{};
+		_intProperties = [RocksDBMetricsExporter defaultIntProperties];
+		_databases = [NSMapTable weakToStrongObjectsMapTable];
+	}
+	return self;
+}
+
++ (NSArray<NSString *> *)defaultIntProperties
+{
+	return @[
+		@"rocksdb.estimate-pending-compaction-bytes",
+		@"rocksdb.cur-size-all-mem-tables",
+		@"rocksdb.size-all-mem-tables",
+		@"rocksdb.num-immutable-mem-table",
+		@"rocksdb.live-sst-files-size",
+		@"rocksdb.total-sst-files-size",
+		@"rocksdb.num-running-compactions",
+		@"rocksdb.num-running-flushes",
+		@"rocksdb.estimate-num-keys",
+		@"rocksdb.estimate-table-readers-mem",
+		@"rocksdb.is-write-stopped",
+		@"rocksdb.actual-delayed-write-rate"
+	];
+}
+
+#pragma mark - Databases
+
+- (void)addDatabase:(RocksDB *)database withName:(NSString *)name
+{
+	@synchronized(self) {
+		[_databases setObject:[name copy] forKey:database];
+	}
+}
+
+- (void)removeDatabase:(RocksDB *)database
+{
+	@synchronized(self) {
+		[_databases removeObjectForKey:database];
+	}
+}
+
+#pragma mark - Export
+
+- (NSData *)exportMetrics
+{
+	std::string buffer = [self renderMetrics];
+	return [NSData dataWithBytes:buffer.data() length:buffer.size()];
+}
+
+- (BOOL)writeToFileDescriptor:(int)fileDescriptor error:(NSError * __autoreleasing *)error
+{
+	std::string buffer = [self renderMetrics];
+
+	size_t written = 0;
+	while (written < buffer.size()) {
+		ssize_t result = write(fileDescriptor, buffer.data() + written, buffer.size() - written);
+		if (result < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			NSError *temp = [RocksDBError errorWithRocksStatus:rocksdb::Status::IOError("Writing metrics failed", strerror(errno))];
+			if (error && *error == nil) {
+				*error = temp;
+			}
+			return NO;
+		}
+		written += result;
+	}
+	return YES;
+}
+
+- (std::string)renderMetrics
+{
+	BOOL openMetrics = _format == RocksDBMetricsFormatOpenMetrics;
+
+	std::string labels;
+	for (NSString *name in [_labels.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+		if (!labels.empty()) {
+			labels.push_back(',');
+		}
+		labels.append(MetricName(name.UTF8String));
+		labels.append("=\"");
+		AppendLabelValue(&labels, _labels[name].UTF8String);
+		labels.push_back('"');
+	}
+
+	std::string buffer;
+	buffer.reserve(64 * 1024);
+
+	std::shared_ptr<rocksdb::Statistics> statistics = _statistics.statistics;
+	if (statistics != nullptr) {
+		for (const auto &ticker : rocksdb::TickersNameMap) {
+			std::string name = MetricName(ticker.second);
+			buffer.append("# TYPE ").append(name).append(openMetrics ? " counter\n" : "_total counter\n");
+			buffer.append(name).append("_total");
+			AppendLabels(&buffer, labels);
+			AppendValue(&buffer, statistics->getTickerCount(ticker.first));
+		}
+
+		for (const auto &histogram : rocksdb::HistogramsNameMap) {
+			rocksdb::HistogramData data;
+			statistics->histogramData(histogram.first, &data);
+
+			std::string name = MetricName(histogram.second);
+			buffer.append("# TYPE ").append(name).append(" summary\n");
+
+			const std::pair<const char *, double> quantiles[] = {
+				{"0.5", data.median}, {"0.95", data.percentile95}, {"0.99", data.percentile99}, {"1", data.max}
+			};
+			for (const auto &quantile : quantiles) {
+				buffer.append(name);
+				AppendLabels(&buffer, labels, "quantile", quantile.first);
+				AppendValue(&buffer, quantile.second);
+			}
+			buffer.append(name).append("_sum");
+			AppendLabels(&buffer, labels);
+			AppendValue(&buffer, data.sum);
+			buffer.append(name).append("_count");
+			AppendLabels(&buffer, labels);
+			AppendValue(&buffer, data.count);
+		}
+	}
+
+	// Collect the registered databases, ordered by database name.
+	std::vector<std::pair<std::string, RocksDB *>> databases;
+	@synchronized(self) {
+		for (RocksDB *database in _databases) {
+			std::string dbLabels = labels;
+			if (!dbLabels.empty()) {
+				dbLabels.push_back(',');
+			}
+			dbLabels.append("db=\"");
+			AppendLabelValue(&dbLabels, [_databases objectForKey:database].UTF8String);
+			dbLabels.push_back('"');
+			databases.push_back({dbLabels, database});
+		}
+	}
+	std::stable_sort(databases.begin(), databases.end(), [](const auto &a, const auto &b) {
+		return a.first < b.first;
+	});
+
+	// Read the properties while holding the lock of each database, which `close` takes as well,
+	// so that a database can't be closed under the native handles. Closed databases are skipped.
+	NSArray<NSString *> *intProperties = _intProperties;
+	std::vector<std::vector<std::pair<std::string, uint64_t>>> samples(intProperties.count);
+	for (const auto &entry : databases) {
+		RocksDB *database = entry.second;
+		@synchronized(database) {
+			if ([database isClosed]) {
+				continue;
+			}
+
+			NSArray<RocksDBColumnFamilyHandle *> *handles = database.columnFamilies;
+			if (handles.count == 0) {
+				handles = @[database.columnFamily];
+			}
+			for (RocksDBColumnFamilyHandle *handle in handles) {
+				std::string cfLabels = entry.first;
+				cfLabels.append(",cf=\"");
+				AppendLabelValue(&cfLabels, handle.columnFamily->GetName());
+				cfLabels.push_back('"');
+
+				for (NSUInteger i = 0; i < intProperties.count; i++) {
+					uint64_t value;
+					if (database.db->GetIntProperty(handle.columnFamily, intProperties[i].UTF8String, &value)) {
+						samples[i].push_back({cfLabels, value});
+					}
+				}
+			}
+		}
+	}
+
+	for (NSUInteger i = 0; i < intProperties.count; i++) {
+		if (samples[i].empty()) {
+			continue;
+		}
+		std::string name = MetricName(intProperties[i].UTF8String);
+		buffer.append("# TYPE ").append(name).append(" gauge\n");
+		for (const auto &sample : samples[i]) {
+			buffer.append(name);
+			AppendLabels(&buffer, sample.first);
+			AppendValue(&buffer, sample.second);
+		}
+	}
+
+	if (openMetrics) {
+		buffer.append("# EOF\n");
+	}
+	return buffer;
+}
+
+@end
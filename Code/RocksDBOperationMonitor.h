@@ -0,0 +1,93 @@
+//
+//  RocksDBOperationMonitor.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+#import "RocksDBThreadStatus.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDBEnv;
+
+/**
+ The operations that were running on the threads of an Env at one point in time.
+ */
+@interface RocksDBOperationSample : NSObject
+
+/** @brief The time the sample was taken. */
+@property (nonatomic, strong, readonly) NSDate *timestamp;
+
+/** @brief The status of all threads that were running an operation, e.g. a flush or a compaction. */
+@property (nonatomic, copy, readonly) NSArray<RocksDBThreadStatus *> *operations;
+
+/**
+ @brief The operation with the highest I/O rate, i.e. the one that is currently saturating the disk,
+ or nil if no flush or compaction was running.
+ */
+@property (nonatomic, strong, readonly, nullable) RocksDBThreadStatus *busiestOperation;
+
+/**
+ Returns the bytes read and written per second by the given operation.
+
+ @discussion The rate is computed against the same job in the previous sample of the monitor. For a
+ job that is seen for the first time the average rate since the start of the job is returned.
+
+ @param operation One of the operations of this sample.
+ @return The I/O rate in bytes per second.
+ */
+- (double)bytesPerSecondForOperation:(RocksDBThreadStatus *)operation NS_SWIFT_NAME(bytesPerSecond(for:));
+
+@end
+
+/**
+ Samples the status of the threads of a `RocksDBEnv` on demand or periodically, and keeps the most
+ recent samples in a ring buffer.
+
+ @discussion Only the DBs opened with `enableThreadTracking` report their operations. When RocksDB is
+ built without thread status support, i.e. `ROCKSDB_USING_THREAD_STATUS` is not set, all samples are empty.
+
+ @warning Not available in RocksDB Lite.
+ */
+@interface RocksDBOperationMonitor : NSObject
+
+/** @brief The maximum number of samples retained. */
+@property (nonatomic, assign, readonly) NSUInteger capacity;
+
+/** @brief The retained samples, ordered from the oldest to the newest. */
+@property (nonatomic, copy, readonly) NSArray<RocksDBOperationSample *> *samples;
+
+/** @brief The most recent sample, or nil if none was taken yet. */
+@property (nonatomic, strong, readonly, nullable) RocksDBOperationSample *latestSample;
+
+/**
+ Initializes a new monitor for the given Env.
+
+ @param env The Env whose threads are sampled.
+ @param capacity The number of samples to retain.
+ @return A newly-initialized instance of `RocksDBOperationMonitor`.
+ */
+- (instancetype)initWithEnv:(RocksDBEnv *)env capacity:(NSUInteger)capacity;
+
+/**
+ Takes a sample of the running operations now and appends it to the ring buffer.
+
+ @return The new sample.
+ */
+- (RocksDBOperationSample *)sample;
+
+/**
+ Starts taking a sample every `interval` seconds on a background queue. Any previously started
+ periodic sampling is replaced.
+
+ @param interval The sampling interval in seconds.
+ */
+- (void)startSamplingWithInterval:(NSTimeInterval)interval NS_SWIFT_NAME(startSampling(interval:));
+
+/** @brief Stops the periodic sampling. */
+- (void)stopSampling;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,205 @@
+//
+//  RocksDBOperationMonitor.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBOperationMonitor.h"
+#import "RocksDBEnv.h"
+#import "RocksDBEnv+Private.h"
+#import "RocksDBThreadStatus+Private.h"
+
+#import <rocksdb/env.h>
+#import <rocksdb/thread_status.h>
+
+#pragma mark - Sample
+
+@interface RocksDBOperationSample ()
+{
+	NSDictionary<NSNumber *, NSNumber *> *_rates;
+}
+@property (nonatomic, strong) NSDate *timestamp;
+@property (nonatomic, copy) NSArray<RocksDBThreadStatus *> *operations;
+@property (nonatomic, strong) RocksDBThreadStatus *busiestOperation;
+@end
+
+@implementation RocksDBOperationSample
+@synthesize timestamp, operations, busiestOperation;
+
+static uint64_t IOBytes(RocksDBThreadStatus *operation)
+{
+	return operation.bytesRead + operation.bytesWritten;
+}
+
+- (instancetype)initWithOperations:(NSArray<RocksDBThreadStatus *> *)operations
+					previousSample:(RocksDBOperationSample *)previous
+{
+	self = [super init];
+	if (self) {
+		self.timestamp = [NSDate date];
+		self.operations = operations;
+
+		NSMutableDictionary *rates = [NSMutableDictionary dictionaryWithCapacity:operations.count];
+		double busiestRate = -1;
+		for (RocksDBThreadStatus *operation in operations) {
+			RocksDBThreadStatus *before = nil;
+			for (RocksDBThreadStatus *candidate in previous.operations) {
+				if (candidate.threadId == operation.threadId
+					&& candidate.operationType == operation.operationType
+					&& candidate.jobId == operation.jobId) {
+					before = candidate;
+					break;
+				}
+			}
+
+			double rate = 0;
+			NSTimeInterval interval = [self.timestamp timeIntervalSinceDate:previous.timestamp];
+			if (before != nil && interval > 0) {
+				rate = (IOBytes(operation) - MIN(IOBytes(before), IOBytes(operation))) / interval;
+			} else if (operation.operationElapsedMicros > 0) {
+				rate = IOBytes(operation) * 1000000.0 / operation.operationElapsedMicros;
+			}
+			rates[@(operation.threadId)] = @(rate);
+
+			BOOL background = operation.operationType == RocksDBOperationCompaction
+				|| operation.operationType == RocksDBOperationFlush;
+			if (background && rate > busiestRate) {
+				busiestRate = rate;
+				self.busiestOperation = operation;
+			}
+		}
+		_rates = rates;
+	}
+	return self;
+}
+
+- (double)bytesPerSecondForOperation:(RocksDBThreadStatus *)operation
+{
+	return [_rates[@(operation.threadId)] doubleValue];
+}
+
+@end
+
+#pragma mark - Monitor
+
+@interface RocksDBOperationMonitor ()
+{
+	RocksDBEnv *_env;
+	NSUInteger _capacity;
+	NSMutableArray<RocksDBOperationSample *> *_samples;
+	NSUInteger _head;
+	dispatch_queue_t _queue;
+	dispatch_source_t _timer;
+}
+@end
+
+@implementation RocksDBOperationMonitor
+@synthesize capacity = _capacity;
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithEnv:(RocksDBEnv *)env capacity:(NSUInteger)capacity
+{
+	self = [super init];
+	if (self) {
+		_env = env;
+		_capacity = MAX(capacity, 1);
+		_samples = [NSMutableArray arrayWithCapacity:_capacity];
+		_head = 0;
+		_queue = dispatch_queue_create("objectiverocks.operation-monitor", DISPATCH_QUEUE_SERIAL);
+	}
+	return self;
+}
+
+- (void)dealloc
+{
+	[self stopSampling];
+}
+
+#pragma mark - Sampling
+
+- (NSArray<RocksDBThreadStatus *> *)runningOperations
+{
+	NSMutableArray *operations = [NSMutableArray array];
+#if ROCKSDB_USING_THREAD_STATUS
+	std::vector<rocksdb::ThreadStatus> threadList;
+	_env.env->GetThreadList(&threadList);
+	for (const auto &status : threadList) {
+		if (status.operation_type == rocksdb::ThreadStatus::OP_UNKNOWN) {
+			continue;
+		}
+		[operations addObject:[[RocksDBThreadStatus alloc] initWithThreadStatus:status]];
+	}
+#endif
+	return operations;
+}
+
+- (RocksDBOperationSample *)sample
+{
+	NSArray *operations = [self runningOperations];
+
+	@synchronized(self) {
+		RocksDBOperationSample *sample = [[RocksDBOperationSample alloc] initWithOperations:operations
+																			previousSample:self.latestSample];
+		if (_samples.count < _capacity) {
+			[_samples addObject:sample];
+		} else {
+			_samples[_head] = sample;
+			_head = (_head + 1) % _capacity;
+		}
+		return sample;
+	}
+}
+
+- (NSArray<RocksDBOperationSample *> *)samples
+{
+	@synchronized(self) {
+		NSMutableArray *ordered = [NSMutableArray arrayWithCapacity:_samples.count];
+		for (NSUInteger i = 0; i < _samples.count; i++) {
+			[ordered addObject:_samples[(_head + i) % _samples.count]];
+		}
+		return ordered;
+	}
+}
+
+- (RocksDBOperationSample *)latestSample
+{
+	@synchronized(self) {
+		if (_samples.count == 0) {
+			return nil;
+		}
+		return _samples[(_head + _samples.count - 1) % _samples.count];
+	}
+}
+
+- (void)startSamplingWithInterval:(NSTimeInterval)interval
+{
+	[self stopSampling];
+
+	dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, _queue);
+	uint64_t nanos = (uint64_t)(interval * NSEC_PER_SEC);
+	dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, nanos), nanos, nanos / 10);
+
+	__weak RocksDBOperationMonitor *weakSelf = self;
+	dispatch_source_set_event_handler(timer, ^{
+		[weakSelf sample];
+	});
+
+	@synchronized(self) {
+		_timer = timer;
+	}
+	dispatch_resume(timer);
+}
+
+- (void)stopSampling
+{
+	dispatch_source_t timer = nil;
+	@synchronized(self) {
+		timer = _timer;
+		_timer = nil;
+	}
+	if (timer != nil) {
+		dispatch_source_cancel(timer);
+	}
+}
+
+@end
@@ -10,12 +10,27 @@
 #import "RocksDBDatabaseOptions.h"
 #import "RocksDBColumnFamilyOptions.h"
 
+@class RocksDBCache;
+@class RocksDBWriteBufferManager;
 @class RocksDBComparator;
 @class RocksDBMergeOperator;
 @class RocksDBPrefixExtractor;
+@class RocksDBTablePropertiesCollectorFactory;
+@class RocksDBCompressionOptions;
 
 NS_ASSUME_NONNULL_BEGIN
 
+#if !defined(ROCKSDB_LITE)
+/** @brief The SST table formats for the in-memory serving configuration. */
+typedef NS_ENUM(NSUInteger, RocksDBInMemoryTableFormat)
+{
+	/** @brief PlainTable with a hash index over the key prefixes. Supports prefix iteration. */
+	RocksDBInMemoryTableFormatPlain,
+	/** @brief Cuckoo hash table. Point lookups only, no merge operator support. */
+	RocksDBInMemoryTableFormatCuckoo
+};
+#endif
+
 #pragma mark - Options
 
 /**
@@ -36,6 +51,29 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initWithDatabaseOptions:(RocksDBDatabaseOptions *)dbOptions
 				 andColumnFamilyOptions:(RocksDBColumnFamilyOptions *)columnFamilyOptions;
 
+#if !defined(ROCKSDB_LITE)
+
+/**
+ Configures these options for serving lookups from data that fits entirely in RAM.
+
+ @discussion This enables mmap reads, selects the given mmap-based table format, which
+ needs no block cache, and a hash-based memtable. When `prefixLength` is greater than 0, a
+ fixed-length prefix extractor is also set, which the PlainTable hash index and the hash
+ memtable are keyed by. Without a prefix extractor the memtable falls back to a skip list.
+
+ @param format The SST table format.
+ @param prefixLength The length of the key prefix, 0 for none.
+
+ @see RocksDBPlainTableOptions
+ @see RocksDBCuckooTableOptions
+
+ @warning Not available in RocksDB Lite.
+ */
+- (void)optimizeForInMemoryServingWithTableFormat:(RocksDBInMemoryTableFormat)format
+									 prefixLength:(size_t)prefixLength;
+
+#endif
+
 @end
 
 #pragma mark - DB Options
@@ -92,8 +130,63 @@ NS_ASSUME_NONNULL_BEGIN
  @see RocksDBStatistics
  */
 @property (nonatomic, strong, nullable) RocksDBStatistics *statistics;
+
+/** @brief If true, comparator, merge operator and prefix extractor callbacks are attributed to
+ the foreground or the background context in their `RocksDBInvocationStatistics`. This installs an
+ event listener that is notified of every flush and compaction. Without it all callbacks are
+ recorded in the foreground context.
+ The default is false.
+
+ @see RocksDBInvocationStatistics
+ */
+@property (nonatomic, assign) BOOL trackCallbackContext;
 #endif
 
+/** @brief If not zero, dump the DB statistics to the info log every statsDumpPeriodSec seconds.
+ The default is 600. */
+@property (nonatomic, assign) unsigned int statsDumpPeriodSec;
+
+/** @brief If not zero, snapshot the tickers of the DB statistics every statsPersistPeriodSec
+ seconds, and keep the changes in memory, or on disk if `persistStatsToDisk` is set.
+ The history can be read with `-[RocksDB statsHistoryFrom:to:error:]`.
+ The default is 600. */
+@property (nonatomic, assign) unsigned int statsPersistPeriodSec;
+
+/** @brief If true, the stats history is persisted to the hidden column family
+ "___rocksdb_stats_history___" of the DB, so that it survives restarts.
+ The default is false. */
+@property (nonatomic, assign) BOOL persistStatsToDisk;
+
+/** @brief The maximum memory used by the in-memory stats history, in bytes. The oldest
+ snapshots are dropped once the limit is reached.
+ The default is 1MB. */
+@property (nonatomic, assign) size_t statsHistoryBufferSize;
+
+/** @brief If true, the status of the threads involved in this DB is tracked and can be read
+ with `-[RocksDBEnv threadList]` or sampled with a `RocksDBOperationMonitor`.
+ The default is false. */
+@property (nonatomic, assign) BOOL enableThreadTracking;
+
+/** @brief A global cache for table-level rows, i.e. the results of point lookups.
+ Lookups that hit the row cache skip the index, filter and data block reads.
+ Hits and misses are reported via `RocksDBTickerRowCacheHit` and
+ `RocksDBTickerRowCacheMiss` when statistics are enabled.
+ The row cache must be an LRU cache, setting a HyperClockCache raises an `NSInvalidArgumentException`.
+ The default is nil (disabled).
+
+ @see RocksDBCache
+ */
+@property (nonatomic, strong, nullable) RocksDBCache *rowCache;
+
+/** @brief If non-nil, the memtable memory of all Column Families is accounted
+ against, and limited by, this manager. The same manager can be shared between
+ several DB instances to enforce a single memtable budget across them.
+ The default is nil.
+
+ @see RocksDBWriteBufferManager
+ */
+@property (nonatomic, strong, nullable) RocksDBWriteBufferManager *writeBufferManager;
+
 /** @brief If true, then the contents of manifest and data files are not 
  synced to stable storage.
  The default is false. */
@@ -121,6 +214,15 @@ NS_ASSUME_NONNULL_BEGIN
  The default is 0. */
 @property (nonatomic, assign) uint64_t bytesPerSync;
 
+/** @brief Allows the OS to mmap files for reading SST tables.
+ Required by the PlainTable and Cuckoo table formats.
+ The default is false. */
+@property (nonatomic, assign) BOOL allowMmapReads;
+
+/** @brief Allows the OS to mmap files for writing.
+ The default is false. */
+@property (nonatomic, assign) BOOL allowMmapWrites;
+
 @end
 
 #pragma mark - Column Family Options
@@ -172,6 +274,34 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, assign) RocksDBCompressionType compressionType;
 
+/** @brief Compress the blocks of each level with a different compression algorithm.
+ Each element is a `RocksDBCompressionType`, the first for level-0. When set, the array
+ takes precedence over `compressionType`, and levels past the end of the array use its
+ last element. A common setup is no or LZ4 compression for the upper levels, which are
+ rewritten often, and ZSTD for the lower levels, which hold most of the data.
+ Default: empty
+ */
+@property (nonatomic, copy) NSArray<NSNumber *> *compressionPerLevel;
+
+/** @brief Compress the blocks of the bottommost level with this algorithm, overriding
+ `compressionType` and `compressionPerLevel` for it.
+ Default: RocksDBCompressionDisableOption
+ */
+@property (nonatomic, assign) RocksDBCompressionType bottommostCompressionType;
+
+/** @brief Options to fine-tune the compression algorithms, e.g. dictionary compression.
+
+ @see RocksDBCompressionOptions
+ */
+@property (nonatomic, strong, readonly) RocksDBCompressionOptions *compressionOptions;
+
+/** @brief Options to fine-tune the compression algorithm of the bottommost level. These
+ take effect only when `enabled` is set on them.
+
+ @see RocksDBCompressionOptions
+ */
+@property (nonatomic, strong, readonly) RocksDBCompressionOptions *bottommostCompressionOptions;
+
 /** @brief Set compaction style for DB.
  Default: RocksDBCompactionStyleLevel
  */
@@ -286,6 +416,21 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong, nullable) RocksDBTableFactory *tableFacotry;
 
+#if !defined(ROCKSDB_LITE)
+
+/** @brief A list of factories for the collectors that gather user-defined properties
+ while SST files are built. The collected properties can be read back via
+ `-[RocksDB propertiesOfAllTables:]`.
+ Default: empty
+
+ @see RocksDBTablePropertiesCollectorFactory
+
+ @warning Not available in RocksDB Lite.
+ */
+@property (nonatomic, copy) NSArray<RocksDBTablePropertiesCollectorFactory *> *tablePropertiesCollectorFactories;
+
+#endif
+
 /** @brief If prefixExtractor is set and bloom_bits is not 0, create prefix bloom
  for memtable
 
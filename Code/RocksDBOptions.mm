@@ -12,6 +12,11 @@
 #import "RocksDBMergeOperator.h"
 #import "RocksDBPrefixExtractor.h"
 
+#if !defined(ROCKSDB_LITE)
+#import "RocksDBTableFactory.h"
+#import "RocksDBMemTableRepFactory.h"
+#endif
+
 #import <rocksdb/options.h>
 #import <rocksdb/comparator.h>
 #import <rocksdb/merge_operator.h>
@@ -62,6 +67,40 @@
 	return self;
 }
 
+#if !defined(ROCKSDB_LITE)
+
+#pragma mark - Presets
+
+- (void)optimizeForInMemoryServingWithTableFormat:(RocksDBInMemoryTableFormat)format
+									 prefixLength:(size_t)prefixLength
+{
+	_databaseOptions.allowMmapReads = YES;
+
+	if (prefixLength > 0) {
+		_columnFamilyOption.prefixExtractor = [RocksDBPrefixExtractor prefixExtractorWithType:RocksDBPrefixFixedLength
+																					   length:prefixLength];
+	}
+
+	switch (format) {
+		case RocksDBInMemoryTableFormatPlain:
+			_columnFamilyOption.tableFacotry = [RocksDBTableFactory plainTableFactoryWithOptions:^(RocksDBPlainTableOptions *options) {
+				options.hashTableRatio = 0.75;
+				options.bloomBitsPerKey = 10;
+			}];
+			_columnFamilyOption.memTableRepFactory = [RocksDBMemTableRepFactory hashSkipListRepFactory];
+			break;
+
+		case RocksDBInMemoryTableFormatCuckoo:
+			_columnFamilyOption.tableFacotry = [RocksDBTableFactory cuckooTableFactoryWithOptions:^(RocksDBCuckooTableOptions *options) {
+				options.useModuleHash = NO;
+			}];
+			_columnFamilyOption.memTableRepFactory = [RocksDBMemTableRepFactory hashLinkListRepFactory];
+			break;
+	}
+}
+
+#endif
+
 #pragma mark - Property
 
 - (rocksdb::Options)options
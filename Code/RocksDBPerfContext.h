@@ -0,0 +1,162 @@
+//
+//  RocksDBPerfContext.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** @brief The level of detail of the per-operation performance counters. */
+typedef NS_ENUM(NSUInteger, RocksDBPerfLevel)
+{
+	/** @brief Disable all counters. */
+	RocksDBPerfLevelDisable,
+	/** @brief Enable only count statistics. */
+	RocksDBPerfLevelEnableCount,
+	/** @brief Enable counts and time statistics, except for mutex wait times. */
+	RocksDBPerfLevelEnableTimeExceptForMutex,
+	/** @brief Enable all counts and time statistics, including mutex wait times. */
+	RocksDBPerfLevelEnableTime
+};
+
+/**
+ A breakdown of the work done by the RocksDB operations executed on the current thread within
+ a measured block, e.g. a single `dataForKey:` call or an iterator seek. All times are in
+ nanoseconds and only collected when the `RocksDBPerfLevel` enables them.
+
+ Unlike `RocksDBStatistics`, which aggregates over all threads of a DB, the counters are
+ thread-local, so the measured operations must run synchronously inside the block.
+
+ @see RocksDBPerfContextSampler
+ */
+@interface RocksDBPerfContext : NSObject
+
+/**
+ Runs the given block with the counters of the current thread reset and enabled at the given
+ level, and returns the counters collected during the block. The previous perf level of the
+ thread is restored afterwards. Measurements cannot be nested.
+
+ @param level The perf level to collect the counters with.
+ @param block The block running the operations to measure.
+ @return The counters collected while running the block.
+ */
++ (RocksDBPerfContext *)measureWithLevel:(RocksDBPerfLevel)level
+							  usingBlock:(void (NS_NOESCAPE ^)(void))block NS_SWIFT_NAME(measure(level:block:));
+
+/** @brief Total number of user key comparisons. */
+@property (nonatomic, readonly) uint64_t userKeyComparisonCount;
+/** @brief Total number of block cache hits. */
+@property (nonatomic, readonly) uint64_t blockCacheHitCount;
+/** @brief Total number of block reads, with IO. */
+@property (nonatomic, readonly) uint64_t blockReadCount;
+/** @brief Total number of bytes read from blocks. */
+@property (nonatomic, readonly) uint64_t blockReadByte;
+/** @brief Total time spent reading blocks. */
+@property (nonatomic, readonly) uint64_t blockReadTime;
+/** @brief Total time spent verifying block checksums. */
+@property (nonatomic, readonly) uint64_t blockChecksumTime;
+/** @brief Total time spent decompressing blocks. */
+@property (nonatomic, readonly) uint64_t blockDecompressTime;
+/** @brief Bytes of the values returned by point lookups. */
+@property (nonatomic, readonly) uint64_t getReadBytes;
+/** @brief Bytes of the keys and values returned by iterators. */
+@property (nonatomic, readonly) uint64_t iterReadBytes;
+/** @brief Number of internal keys skipped while iterating, e.g. overwritten versions. */
+@property (nonatomic, readonly) uint64_t internalKeySkippedCount;
+/** @brief Number of deletion tombstones skipped while iterating. */
+@property (nonatomic, readonly) uint64_t internalDeleteSkippedCount;
+/** @brief Number of merge operands processed. */
+@property (nonatomic, readonly) uint64_t internalMergeCount;
+/** @brief Time spent getting the snapshot for a point lookup. */
+@property (nonatomic, readonly) uint64_t getSnapshotTime;
+/** @brief Time spent querying the memtables in point lookups. */
+@property (nonatomic, readonly) uint64_t getFromMemtableTime;
+/** @brief Number of memtables queried in point lookups. */
+@property (nonatomic, readonly) uint64_t getFromMemtableCount;
+/** @brief Time spent after a point lookup found its value. */
+@property (nonatomic, readonly) uint64_t getPostProcessTime;
+/** @brief Time spent querying the SST files in point lookups. */
+@property (nonatomic, readonly) uint64_t getFromOutputFilesTime;
+/** @brief Time spent seeking in the memtables. */
+@property (nonatomic, readonly) uint64_t seekOnMemtableTime;
+/** @brief Number of seeks in the memtables. */
+@property (nonatomic, readonly) uint64_t seekOnMemtableCount;
+/** @brief Time spent seeking the internal iterators. */
+@property (nonatomic, readonly) uint64_t seekInternalSeekTime;
+/** @brief Time spent finding the next user entry while iterating, e.g. skipping tombstones. */
+@property (nonatomic, readonly) uint64_t findNextUserEntryTime;
+/** @brief Time spent writing to the WAL. */
+@property (nonatomic, readonly) uint64_t writeWalTime;
+/** @brief Time spent writing to the memtables. */
+@property (nonatomic, readonly) uint64_t writeMemtableTime;
+/** @brief Time writes were delayed or stalled. */
+@property (nonatomic, readonly) uint64_t writeDelayTime;
+/** @brief Time spent acquiring the DB mutex. */
+@property (nonatomic, readonly) uint64_t dbMutexLockNanos;
+/** @brief Time spent waiting on a condition variable of the DB mutex. */
+@property (nonatomic, readonly) uint64_t dbConditionWaitNanos;
+/** @brief Number of memtable bloom filter hits. */
+@property (nonatomic, readonly) uint64_t bloomMemtableHitCount;
+/** @brief Number of memtable bloom filter misses. */
+@property (nonatomic, readonly) uint64_t bloomMemtableMissCount;
+/** @brief Number of SST bloom filter hits. */
+@property (nonatomic, readonly) uint64_t bloomSstHitCount;
+/** @brief Number of SST bloom filter misses. */
+@property (nonatomic, readonly) uint64_t bloomSstMissCount;
+
+/** @brief Number of bytes read from files. */
+@property (nonatomic, readonly) uint64_t ioBytesRead;
+/** @brief Number of bytes written to files. */
+@property (nonatomic, readonly) uint64_t ioBytesWritten;
+/** @brief Time spent in file reads. */
+@property (nonatomic, readonly) uint64_t ioReadNanos;
+/** @brief Time spent in file writes. */
+@property (nonatomic, readonly) uint64_t ioWriteNanos;
+/** @brief Time spent in fsync. */
+@property (nonatomic, readonly) uint64_t ioFsyncNanos;
+/** @brief Time spent opening files. */
+@property (nonatomic, readonly) uint64_t ioOpenNanos;
+
+/** @brief String representation of all non-zero counters. */
+- (NSString *)description;
+
+@end
+
+/**
+ Measures a configurable fraction of the executed blocks with `RocksDBPerfContext`, in order to
+ attribute the cost of individual requests in production without paying the overhead of the
+ counters on every request.
+ */
+@interface RocksDBPerfContextSampler : NSObject
+
+/**
+ Initializes a new sampler.
+
+ @param sampleRate The fraction of blocks to measure, between 0 and 1.
+ @param level The perf level to measure the sampled blocks with.
+ @param handler The handler called with the counters of each sampled block, on the thread
+ that ran the block.
+ @return A newly-initialized sampler.
+ */
+- (instancetype)initWithSampleRate:(double)sampleRate
+							 level:(RocksDBPerfLevel)level
+						   handler:(void (^)(RocksDBPerfContext *context))handler;
+
+/** @brief The fraction of blocks to measure, between 0 and 1. */
+@property (atomic, assign) double sampleRate;
+
+/** @brief The perf level to measure the sampled blocks with. */
+@property (nonatomic, readonly) RocksDBPerfLevel level;
+
+/**
+ Runs the given block, measuring it if it is sampled.
+
+ @param block The block running the operations to measure.
+ @return True if the block was measured.
+ */
+- (BOOL)measure:(void (NS_NOESCAPE ^)(void))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,301 @@
+//
+//  RocksDBPerfContext.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBPerfContext.h"
+
+#import <rocksdb/perf_level.h>
+#import <rocksdb/perf_context.h>
+#import <rocksdb/iostats_context.h>
+
+#include <random>
+
+static rocksdb::PerfLevel NativePerfLevel(RocksDBPerfLevel level)
+{
+	switch (level) {
+		case RocksDBPerfLevelDisable:
+			return rocksdb::kDisable;
+		case RocksDBPerfLevelEnableCount:
+			return rocksdb::kEnableCount;
+		case RocksDBPerfLevelEnableTimeExceptForMutex:
+			return rocksdb::kEnableTimeExceptForMutex;
+		case RocksDBPerfLevelEnableTime:
+			return rocksdb::kEnableTime;
+	}
+}
+
+#pragma mark - Perf Context
+
+@interface RocksDBPerfContext ()
+{
+	rocksdb::PerfContext _perfContext;
+	rocksdb::IOStatsContext _ioStatsContext;
+}
+@end
+
+@implementation RocksDBPerfContext
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithPerfContext:(const rocksdb::PerfContext &)perfContext
+					 ioStatsContext:(const rocksdb::IOStatsContext &)ioStatsContext
+{
+	self = [super init];
+	if (self) {
+		_perfContext = perfContext;
+		_ioStatsContext = ioStatsContext;
+	}
+	return self;
+}
+
++ (RocksDBPerfContext *)measureWithLevel:(RocksDBPerfLevel)level usingBlock:(void (NS_NOESCAPE ^)(void))block
+{
+	rocksdb::PerfLevel previousLevel = rocksdb::GetPerfLevel();
+	rocksdb::SetPerfLevel(NativePerfLevel(level));
+	rocksdb::get_perf_context()->Reset();
+	rocksdb::get_iostats_context()->Reset();
+
+	block();
+
+	RocksDBPerfContext *context = [[RocksDBPerfContext alloc] initWithPerfContext:*rocksdb::get_perf_context()
+																	ioStatsContext:*rocksdb::get_iostats_context()];
+	rocksdb::SetPerfLevel(previousLevel);
+	return context;
+}
+
+#pragma mark - Accessors
+
+- (uint64_t)userKeyComparisonCount
+{
+	return _perfContext.user_key_comparison_count;
+}
+
+- (uint64_t)blockCacheHitCount
+{
+	return _perfContext.block_cache_hit_count;
+}
+
+- (uint64_t)blockReadCount
+{
+	return _perfContext.block_read_count;
+}
+
+- (uint64_t)blockReadByte
+{
+	return _perfContext.block_read_byte;
+}
+
+- (uint64_t)blockReadTime
+{
+	return _perfContext.block_read_time;
+}
+
+- (uint64_t)blockChecksumTime
+{
+	return _perfContext.block_checksum_time;
+}
+
+- (uint64_t)blockDecompressTime
+{
+	return _perfContext.block_decompress_time;
+}
+
+- (uint64_t)getReadBytes
+{
+	return _perfContext.get_read_bytes;
+}
+
+- (uint64_t)iterReadBytes
+{
+	return _perfContext.iter_read_bytes;
+}
+
+- (uint64_t)internalKeySkippedCount
+{
+	return _perfContext.internal_key_skipped_count;
+}
+
+- (uint64_t)internalDeleteSkippedCount
+{
+	return _perfContext.internal_delete_skipped_count;
+}
+
+- (uint64_t)internalMergeCount
+{
+	return _perfContext.internal_merge_count;
+}
+
+- (uint64_t)getSnapshotTime
+{
+	return _perfContext.get_snapshot_time;
+}
+
+- (uint64_t)getFromMemtableTime
+{
+	return _perfContext.get_from_memtable_time;
+}
+
+- (uint64_t)getFromMemtableCount
+{
+	return _perfContext.get_from_memtable_count;
+}
+
+- (uint64_t)getPostProcessTime
+{
+	return _perfContext.get_post_process_time;
+}
+
+- (uint64_t)getFromOutputFilesTime
+{
+	return _perfContext.get_from_output_files_time;
+}
+
+- (uint64_t)seekOnMemtableTime
+{
+	return _perfContext.seek_on_memtable_time;
+}
+
+- (uint64_t)seekOnMemtableCount
+{
+	return _perfContext.seek_on_memtable_count;
+}
+
+- (uint64_t)seekInternalSeekTime
+{
+	return _perfContext.seek_internal_seek_time;
+}
+
+- (uint64_t)findNextUserEntryTime
+{
+	return _perfContext.find_next_user_entry_time;
+}
+
+- (uint64_t)writeWalTime
+{
+	return _perfContext.write_wal_time;
+}
+
+- (uint64_t)writeMemtableTime
+{
+	return _perfContext.write_memtable_time;
+}
+
+- (uint64_t)writeDelayTime
+{
+	return _perfContext.write_delay_time;
+}
+
+- (uint64_t)dbMutexLockNanos
+{
+	return _perfContext.db_mutex_lock_nanos;
+}
+
+- (uint64_t)dbConditionWaitNanos
+{
+	return _perfContext.db_condition_wait_nanos;
+}
+
+- (uint64_t)bloomMemtableHitCount
+{
+	return _perfContext.bloom_memtable_hit_count;
+}
+
+- (uint64_t)bloomMemtableMissCount
+{
+	return _perfContext.bloom_memtable_miss_count;
+}
+
+- (uint64_t)bloomSstHitCount
+{
+	return _perfContext.bloom_sst_hit_count;
+}
+
+- (uint64_t)bloomSstMissCount
+{
+	return _perfContext.bloom_sst_miss_count;
+}
+
+- (uint64_t)ioBytesRead
+{
+	return _ioStatsContext.bytes_read;
+}
+
+- (uint64_t)ioBytesWritten
+{
+	return _ioStatsContext.bytes_written;
+}
+
+- (uint64_t)ioReadNanos
+{
+	return _ioStatsContext.read_nanos;
+}
+
+- (uint64_t)ioWriteNanos
+{
+	return _ioStatsContext.write_nanos;
+}
+
+- (uint64_t)ioFsyncNanos
+{
+	return _ioStatsContext.fsync_nanos;
+}
+
+- (uint64_t)ioOpenNanos
+{
+	return _ioStatsContext.open_nanos;
+}
+
+#pragma mark - Description
+
+- (NSString *)description
+{
+	std::string description = _perfContext.ToString(true) + ", " + _ioStatsContext.ToString(true);
+	return [NSString stringWithCString:description.c_str() encoding:NSUTF8StringEncoding];
+}
+
+@end
+
+#pragma mark - Sampler
+
+@interface RocksDBPerfContextSampler ()
+{
+	void (^ _handler)(RocksDBPerfContext *context);
+}
+@end
+
+@implementation RocksDBPerfContextSampler
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithSampleRate:(double)sampleRate
+							 level:(RocksDBPerfLevel)level
+						   handler:(void (^)(RocksDBPerfContext *context))handler
+{
+	self = [super init];
+	if (self) {
+		_sampleRate = sampleRate;
+		_level = level;
+		_handler = [handler copy];
+	}
+	return self;
+}
+
+#pragma mark - Sampling
+
+- (BOOL)measure:(void (NS_NOESCAPE ^)(void))block
+{
+	static thread_local std::minstd_rand generator(std::random_device{}());
+	std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+	if (distribution(generator) >= self.sampleRate) {
+		block();
+		return NO;
+	}
+
+	RocksDBPerfContext *context = [RocksDBPerfContext measureWithLevel:_level usingBlock:block];
+	_handler(context);
+	return YES;
+}
+
+@end
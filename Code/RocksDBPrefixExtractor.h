@@ -8,6 +8,10 @@
 
 #import <Foundation/Foundation.h>
 
+#if !defined(ROCKSDB_LITE)
+#import "RocksDBInvocationStatistics.h"
+#endif
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -16,7 +20,13 @@ NS_ASSUME_NONNULL_BEGIN
 typedef NS_ENUM(NSUInteger, RocksDBPrefixType)
 {
 	/** @brief Extract a fixed-length prefix for each key. */
-	RocksDBPrefixFixedLength
+	RocksDBPrefixFixedLength,
+
+	/**
+	 @brief Extract the first `length` fields of each key encoded with `RocksDBTupleEncoder`.
+	 Keys with fewer fields are not in the domain of the extractor.
+	 */
+	RocksDBPrefixTupleFields
 };
 
 /**
@@ -31,7 +41,7 @@ typedef NS_ENUM(NSUInteger, RocksDBPrefixType)
  Intializes a new instance of the prefix extarctor with the given type and length.
  
  @param type The type of the prefix extractor.
- @param length The length of the desired prefix.
+ @param length The length of the desired prefix, or the number of fields for `RocksDBPrefixTupleFields`.
  @return A newly-initialized instance of a prefix extractor.
  */
 + (instancetype)prefixExtractorWithType:(RocksDBPrefixType)type length:(size_t)length;
@@ -52,6 +62,20 @@ typedef NS_ENUM(NSUInteger, RocksDBPrefixType)
 		prefixCandidateBlock:(BOOL (^)(NSData *key))prefixCandidateBlock
 			validPrefixBlock:(BOOL (^)(NSData *prefix))validPrefixBlock;
 
+#if !defined(ROCKSDB_LITE)
+
+/**
+ Statistics recording the invocations of, and the time spent in, the extractor blocks, split by
+ foreground and background calling context. Defaults to `nil`, which disables the instrumentation.
+
+ @discussion Set this before opening the database. All three blocks are recorded together. Built-in extractors have no blocks and record nothing.
+
+ @warning Not available in RocksDB Lite.
+ */
+@property (nonatomic, strong, nullable) RocksDBInvocationStatistics *callbackStatistics;
+
+#endif
+
 @end
 
 NS_ASSUME_NONNULL_END
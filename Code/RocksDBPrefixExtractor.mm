@@ -9,6 +9,11 @@
 #import "RocksDBPrefixExtractor.h"
 #import "RocksDBSlice+Private.h"
 #import "RocksDBCallbackSliceTransform.h"
+#import "RocksDBTupleKeyCoding.h"
+
+#if !defined(ROCKSDB_LITE)
+#import "RocksDBInvocationStatistics+Private.h"
+#endif
 
 #import <rocksdb/slice_transform.h>
 #import <rocksdb/slice.h>
@@ -21,6 +26,10 @@
 	NSData * (^ _transformBlock)(NSData *key);
 	BOOL (^ _prefixCandidateBlock)(NSData * key);
 	BOOL (^ _validPrefixBlock)(NSData *prefix);
+
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *_callbackStatistics;
+#endif
 }
 @property (nonatomic, strong) NSString *name;
 @property (nonatomic, assign) const rocksdb::SliceTransform *sliceTransform;
@@ -29,6 +38,9 @@
 @implementation RocksDBPrefixExtractor
 @synthesize name = _name;
 @synthesize sliceTransform = _sliceTransform;
+#if !defined(ROCKSDB_LITE)
+@synthesize callbackStatistics = _callbackStatistics;
+#endif
 
 #pragma mark - Lifecycle
 
@@ -37,6 +49,8 @@
 	switch (type) {
 		case RocksDBPrefixFixedLength:
 			return [[self alloc] initWithNativeSliceTransform:rocksdb::NewFixedPrefixTransform(length)];
+		case RocksDBPrefixTupleFields:
+			return [[self alloc] initWithNativeSliceTransform:RocksDBTuplePrefixSliceTransform(length)];
 	}
 }
 
@@ -88,6 +102,15 @@ rocksdb::Slice trampolineTransform(void* instance, const rocksdb::Slice& src)
 - (NSData *)transformKey:(const rocksdb::Slice &)keySlice
 {
 	NSData *key = DataFromSlice(keySlice);
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *statistics = _callbackStatistics;
+	if (statistics != nil) {
+		uint64_t start = RocksDBCallbackNowNanos();
+		NSData *transformed = _transformBlock(key);
+		[statistics recordNanos:RocksDBCallbackNowNanos() - start];
+		return transformed;
+	}
+#endif
 	NSData * transformed = _transformBlock(key);
 	return transformed;
 }
@@ -100,6 +123,15 @@ bool trampolineInDomain(void* instance, const rocksdb::Slice& src)
 - (BOOL)isKeyPrefixCandidate:(const rocksdb::Slice &)keySlice
 {
 	NSData *key = DataFromSlice(keySlice);
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *statistics = _callbackStatistics;
+	if (statistics != nil) {
+		uint64_t start = RocksDBCallbackNowNanos();
+		BOOL candidate = _prefixCandidateBlock(key);
+		[statistics recordNanos:RocksDBCallbackNowNanos() - start];
+		return candidate;
+	}
+#endif
 	return _prefixCandidateBlock(key);
 }
 
@@ -111,6 +143,15 @@ bool trampolineInRange(void* instance, const rocksdb::Slice& dst)
 - (BOOL)isPrefixValid:(const rocksdb::Slice &)prefixSlice
 {
 	NSData *prefix = DataFromSlice(prefixSlice);
+#if !defined(ROCKSDB_LITE)
+	RocksDBInvocationStatistics *statistics = _callbackStatistics;
+	if (statistics != nil) {
+		uint64_t start = RocksDBCallbackNowNanos();
+		BOOL valid = _validPrefixBlock(prefix);
+		[statistics recordNanos:RocksDBCallbackNowNanos() - start];
+		return valid;
+	}
+#endif
 	return _validPrefixBlock(prefix);
 }
 
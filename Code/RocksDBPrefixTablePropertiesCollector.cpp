@@ -0,0 +1,99 @@
+//
+//  RocksDBPrefixTablePropertiesCollector.cpp
+//  ObjectiveRocks
+//
+
+#import "RocksDBPrefixTablePropertiesCollector.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+
+const char* kRocksDBPrefixCountPropertyPrefix = "objectiverocks.prefix.count.";
+
+static std::string HexEncode(const std::string& value)
+{
+	static const char digits[] = "0123456789abcdef";
+	std::string result;
+	result.reserve(value.size() * 2);
+	for (unsigned char c : value) {
+		result.push_back(digits[c >> 4]);
+		result.push_back(digits[c & 0xf]);
+	}
+	return result;
+}
+
+class RocksDBPrefixTablePropertiesCollectorImpl : public rocksdb::TablePropertiesCollector
+{
+private:
+	size_t prefixLength;
+	std::map<std::string, uint64_t> counts;
+
+public:
+	RocksDBPrefixTablePropertiesCollectorImpl(size_t prefixLength): prefixLength(prefixLength) {}
+
+	virtual const char* Name() const
+	{
+		return "objectiverocks.prefix.count";
+	}
+
+	virtual rocksdb::Status AddUserKey(const rocksdb::Slice& key,
+									   const rocksdb::Slice& value,
+									   rocksdb::EntryType type,
+									   rocksdb::SequenceNumber seq,
+									   uint64_t file_size)
+	{
+		if (type != rocksdb::kEntryPut && type != rocksdb::kEntryMerge) {
+			return rocksdb::Status::OK();
+		}
+
+		size_t length = std::min(prefixLength, key.size());
+		// Keys arrive sorted, so consecutive keys usually share the last inserted prefix.
+		std::string prefix(key.data(), length);
+		if (!counts.empty() && counts.rbegin()->first == prefix) {
+			counts.rbegin()->second++;
+		} else {
+			counts[prefix]++;
+		}
+		return rocksdb::Status::OK();
+	}
+
+	virtual rocksdb::Status Finish(rocksdb::UserCollectedProperties* properties)
+	{
+		*properties = GetReadableProperties();
+		return rocksdb::Status::OK();
+	}
+
+	virtual rocksdb::UserCollectedProperties GetReadableProperties() const
+	{
+		rocksdb::UserCollectedProperties properties;
+		for (auto const &entry : counts) {
+			properties[kRocksDBPrefixCountPropertyPrefix + HexEncode(entry.first)] = std::to_string(entry.second);
+		}
+		return properties;
+	}
+};
+
+class RocksDBPrefixTablePropertiesCollectorFactoryImpl : public rocksdb::TablePropertiesCollectorFactory
+{
+private:
+	size_t prefixLength;
+
+public:
+	RocksDBPrefixTablePropertiesCollectorFactoryImpl(size_t prefixLength): prefixLength(prefixLength) {}
+
+	virtual const char* Name() const
+	{
+		return "objectiverocks.prefix.count";
+	}
+
+	virtual rocksdb::TablePropertiesCollector* CreateTablePropertiesCollector(rocksdb::TablePropertiesCollectorFactory::Context context)
+	{
+		return new RocksDBPrefixTablePropertiesCollectorImpl(prefixLength);
+	}
+};
+
+rocksdb::TablePropertiesCollectorFactory* RocksDBPrefixTablePropertiesCollectorFactory(size_t prefixLength)
+{
+	return new RocksDBPrefixTablePropertiesCollectorFactoryImpl(prefixLength);
+}
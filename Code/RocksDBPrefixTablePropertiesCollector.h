@@ -0,0 +1,21 @@
+//
+//  RocksDBPrefixTablePropertiesCollector.h
+//  ObjectiveRocks
+//
+
+#ifndef __ObjectiveRocks__RocksDBPrefixTablePropertiesCollector__
+#define __ObjectiveRocks__RocksDBPrefixTablePropertiesCollector__
+
+#import <rocksdb/table_properties.h>
+
+/** The user-collected property name prefix under which the per-prefix key counts are stored. */
+extern const char* kRocksDBPrefixCountPropertyPrefix;
+
+/**
+ Returns a collector factory that counts the keys sharing the same fixed-length prefix.
+ Each distinct prefix is recorded as `objectiverocks.prefix.count.<hex(prefix)>` with
+ its decimal count as value. Keys shorter than `prefixLength` are counted under the full key.
+ */
+extern rocksdb::TablePropertiesCollectorFactory* RocksDBPrefixTablePropertiesCollectorFactory(size_t prefixLength);
+
+#endif /* defined(__ObjectiveRocks__RocksDBPrefixTablePropertiesCollector__) */
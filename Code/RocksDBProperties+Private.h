@@ -0,0 +1,27 @@
+//
+//  RocksDBProperties+Private.h
+//  ObjectiveRocks
+//
+
+#import "RocksDBProperties.h"
+
+namespace rocksdb {
+	class DB;
+}
+
+/**
+ This category is intended to hide all C++ types from the public interface in order to
+ maintain a pure Objective-C API for Swift compatibility.
+ */
+@interface RocksDBIntPropertyTable (Private)
+
+/**
+ Initializes a new instance of `RocksDBIntPropertyTable` by reading the given int properties
+ of the given column families, and optionally their aggregated values, from the given DB.
+ */
+- (instancetype)initWithDB:(rocksdb::DB *)db
+				properties:(NSArray<RocksDBIntPropertyName> *)properties
+			columnFamilies:(NSArray<RocksDBColumnFamilyHandle *> *)columnFamilies
+				aggregated:(BOOL)aggregated;
+
+@end
@@ -0,0 +1,207 @@
+//
+//  RocksDBProperties.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDBColumnFamilyHandle;
+
+/** @brief The name of a string-valued DB property. */
+typedef NSString * RocksDBPropertyName NS_TYPED_EXTENSIBLE_ENUM;
+
+/** @brief The name of an integer-valued DB property. */
+typedef NSString * RocksDBIntPropertyName NS_TYPED_EXTENSIBLE_ENUM;
+
+/** @brief The name of a map-valued DB property. */
+typedef NSString * RocksDBMapPropertyName NS_TYPED_EXTENSIBLE_ENUM;
+
+#pragma mark - String Properties
+
+/** @brief Multi-line statistics about the column family and the DB. */
+extern RocksDBPropertyName const RocksDBPropertyStats;
+/** @brief Multi-line description of the SST files of each level. */
+extern RocksDBPropertyName const RocksDBPropertySSTables;
+/** @brief Multi-line statistics about the column family. */
+extern RocksDBPropertyName const RocksDBPropertyCFStats;
+/** @brief Like `RocksDBPropertyCFStats` without the file read latency histograms. */
+extern RocksDBPropertyName const RocksDBPropertyCFStatsNoFileHistogram;
+/** @brief The file read latency histograms of the column family. */
+extern RocksDBPropertyName const RocksDBPropertyCFFileHistogram;
+/** @brief Multi-line statistics about the DB. */
+extern RocksDBPropertyName const RocksDBPropertyDBStats;
+/** @brief The number of files and their total size per level. */
+extern RocksDBPropertyName const RocksDBPropertyLevelStats;
+/** @brief The aggregated table properties of all SST files of the column family. */
+extern RocksDBPropertyName const RocksDBPropertyAggregatedTableProperties;
+/** @brief The `RocksDBStatistics` of the DB as a string, if enabled. */
+extern RocksDBPropertyName const RocksDBPropertyOptionsStatistics;
+/** @brief Statistics about the blob files of the column family. */
+extern RocksDBPropertyName const RocksDBPropertyBlobStats;
+
+/**
+ Returns the name of the string property with the number of files at the given level.
+
+ @param level The level.
+ @return The property name.
+ */
+extern RocksDBPropertyName RocksDBPropertyNumFilesAtLevel(int level);
+
+/**
+ Returns the name of the string property with the compression ratio at the given level.
+
+ @param level The level.
+ @return The property name.
+ */
+extern RocksDBPropertyName RocksDBPropertyCompressionRatioAtLevel(int level);
+
+#pragma mark - Int Properties
+
+/** @brief The number of immutable memtables that have not been flushed yet. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumImmutableMemTable;
+/** @brief The number of immutable memtables that have been flushed. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumImmutableMemTableFlushed;
+/** @brief 1 if a memtable flush is pending, 0 otherwise. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyMemTableFlushPending;
+/** @brief The number of currently running flushes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumRunningFlushes;
+/** @brief 1 if at least one compaction is pending, 0 otherwise. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyCompactionPending;
+/** @brief The number of currently running compactions. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumRunningCompactions;
+/** @brief The accumulated number of background errors. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyBackgroundErrors;
+/** @brief The approximate size of the active memtable in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyCurSizeActiveMemTable;
+/** @brief The approximate size of the active and the unflushed immutable memtables in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyCurSizeAllMemTables;
+/** @brief The approximate size of all memtables, including pinned flushed ones, in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertySizeAllMemTables;
+/** @brief The number of entries in the active memtable. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumEntriesActiveMemTable;
+/** @brief The number of entries in the unflushed immutable memtables. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumEntriesImmMemTables;
+/** @brief The number of deletes in the active memtable. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumDeletesActiveMemTable;
+/** @brief The number of deletes in the unflushed immutable memtables. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumDeletesImmMemTables;
+/** @brief The estimated number of keys. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyEstimateNumKeys;
+/** @brief The estimated memory used by table readers, excluding the block cache, in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyEstimateTableReadersMem;
+/** @brief 0 if file deletions are disabled, non-zero otherwise. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyIsFileDeletionsEnabled;
+/** @brief The number of unreleased snapshots. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumSnapshots;
+/** @brief The unix timestamp of the oldest unreleased snapshot. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyOldestSnapshotTime;
+/** @brief The sequence number of the oldest unreleased snapshot. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyOldestSnapshotSequence;
+/** @brief The number of live versions. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumLiveVersions;
+/** @brief The number of the current super version. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyCurrentSuperVersionNumber;
+/** @brief The estimated size of the live data in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyEstimateLiveDataSize;
+/** @brief The minimum log number of the log files that should be kept. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyMinLogNumberToKeep;
+/** @brief The minimum file number of the obsolete SST files that should be kept. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyMinObsoleteSstNumberToKeep;
+/** @brief The total size of all SST files in bytes, including obsolete ones. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyTotalSstFilesSize;
+/** @brief The total size of the SST files of the latest version in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyLiveSstFilesSize;
+/** @brief The level that level 0 data is compacted to. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyBaseLevel;
+/** @brief The estimated number of bytes compaction has to rewrite to get all levels below their target size. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyEstimatePendingCompactionBytes;
+/** @brief The current delayed write rate in bytes per second, or 0 if writes are not delayed. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyActualDelayedWriteRate;
+/** @brief 1 if writes are stopped, 0 otherwise. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyIsWriteStopped;
+/** @brief The estimated unix timestamp of the oldest key, only available for FIFO compaction. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyEstimateOldestKeyTime;
+/** @brief The capacity of the block cache in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyBlockCacheCapacity;
+/** @brief The memory used by the entries of the block cache in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyBlockCacheUsage;
+/** @brief The memory used by the pinned entries of the block cache in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyBlockCachePinnedUsage;
+/** @brief The number of blob files of the current version. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyNumBlobFiles;
+/** @brief The total size of all blob files in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyTotalBlobFileSize;
+/** @brief The total size of the blob files of the current version in bytes. */
+extern RocksDBIntPropertyName const RocksDBIntPropertyLiveBlobFileSize;
+
+#pragma mark - Map Properties
+
+/** @brief The statistics of the column family as a map. */
+extern RocksDBMapPropertyName const RocksDBMapPropertyCFStats;
+/** @brief The statistics of the DB as a map. */
+extern RocksDBMapPropertyName const RocksDBMapPropertyDBStats;
+/** @brief The usage of the block cache by entry role as a map. */
+extern RocksDBMapPropertyName const RocksDBMapPropertyBlockCacheEntryStats;
+/** @brief The aggregated table properties of all SST files of the column family as a map. */
+extern RocksDBMapPropertyName const RocksDBMapPropertyAggregatedTableProperties;
+
+#pragma mark - Int Property Table
+
+/**
+ The values of a set of integer properties for a set of column families, fetched in one call.
+
+ @discussion The values are stored in a flat table with one row per property and one column per
+ column family, in the order they were requested.
+
+ @see -[RocksDB valuesForIntProperties:inColumnFamilies:aggregated:]
+ */
+@interface RocksDBIntPropertyTable : NSObject
+
+/** @brief The properties, i.e. the rows of the table. */
+@property (nonatomic, copy, readonly) NSArray<RocksDBIntPropertyName> *properties;
+
+/** @brief The column families, i.e. the columns of the table. */
+@property (nonatomic, copy, readonly) NSArray<RocksDBColumnFamilyHandle *> *columnFamilies;
+
+/**
+ Returns the value of the property at the given row for the column family at the given column.
+
+ @param row The index of the property.
+ @param column The index of the column family.
+ @return The value, or 0 if the property is not available.
+ */
+- (uint64_t)valueAtRow:(NSUInteger)row column:(NSUInteger)column;
+
+/**
+ Returns whether the property at the given row is available for the column family at the given column.
+
+ @param row The index of the property.
+ @param column The index of the column family.
+ @return `YES` if the value is available, `NO` otherwise.
+ */
+- (BOOL)hasValueAtRow:(NSUInteger)row column:(NSUInteger)column;
+
+/**
+ Returns the value of the property at the given row aggregated over all column families of the DB,
+ as computed by RocksDB. Aggregated values are only read if the table was requested with them.
+
+ @param row The index of the property.
+ @return The aggregated value, or 0 if the property cannot be aggregated or was not aggregated.
+ */
+- (uint64_t)aggregatedValueAtRow:(NSUInteger)row;
+
+/**
+ Returns the value of the given property for the given column family.
+
+ @param property One of the properties of the table.
+ @param columnFamily One of the column families of the table.
+ @return The value, or 0 if the property or the column family is not part of the table.
+ */
+- (uint64_t)valueForProperty:(RocksDBIntPropertyName)property
+			  inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,182 @@
+//
+//  RocksDBProperties.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBProperties.h"
+#import "RocksDBProperties+Private.h"
+#import "RocksDBColumnFamilyHandle.h"
+#import "RocksDBColumnFamilyHandle+Private.h"
+
+#import <rocksdb/db.h>
+
+#include <vector>
+
+#pragma mark - String Properties
+
+RocksDBPropertyName const RocksDBPropertyStats = @"rocksdb.stats";
+RocksDBPropertyName const RocksDBPropertySSTables = @"rocksdb.sstables";
+RocksDBPropertyName const RocksDBPropertyCFStats = @"rocksdb.cfstats";
+RocksDBPropertyName const RocksDBPropertyCFStatsNoFileHistogram = @"rocksdb.cfstats-no-file-histogram";
+RocksDBPropertyName const RocksDBPropertyCFFileHistogram = @"rocksdb.cf-file-histogram";
+RocksDBPropertyName const RocksDBPropertyDBStats = @"rocksdb.dbstats";
+RocksDBPropertyName const RocksDBPropertyLevelStats = @"rocksdb.levelstats";
+RocksDBPropertyName const RocksDBPropertyAggregatedTableProperties = @"rocksdb.aggregated-table-properties";
+RocksDBPropertyName const RocksDBPropertyOptionsStatistics = @"rocksdb.options-statistics";
+RocksDBPropertyName const RocksDBPropertyBlobStats = @"rocksdb.blob-stats";
+
+RocksDBPropertyName RocksDBPropertyNumFilesAtLevel(int level)
+{
+	return [NSString stringWithFormat:@"rocksdb.num-files-at-level%d", level];
+}
+
+RocksDBPropertyName RocksDBPropertyCompressionRatioAtLevel(int level)
+{
+	return [NSString stringWithFormat:@"rocksdb.compression-ratio-at-level%d", level];
+}
+
+#pragma mark - Int Properties
+
+RocksDBIntPropertyName const RocksDBIntPropertyNumImmutableMemTable = @"rocksdb.num-immutable-mem-table";
+RocksDBIntPropertyName const RocksDBIntPropertyNumImmutableMemTableFlushed = @"rocksdb.num-immutable-mem-table-flushed";
+RocksDBIntPropertyName const RocksDBIntPropertyMemTableFlushPending = @"rocksdb.mem-table-flush-pending";
+RocksDBIntPropertyName const RocksDBIntPropertyNumRunningFlushes = @"rocksdb.num-running-flushes";
+RocksDBIntPropertyName const RocksDBIntPropertyCompactionPending = @"rocksdb.compaction-pending";
+RocksDBIntPropertyName const RocksDBIntPropertyNumRunningCompactions = @"rocksdb.num-running-compactions";
+RocksDBIntPropertyName const RocksDBIntPropertyBackgroundErrors = @"rocksdb.background-errors";
+RocksDBIntPropertyName const RocksDBIntPropertyCurSizeActiveMemTable = @"rocksdb.cur-size-active-mem-table";
+RocksDBIntPropertyName const RocksDBIntPropertyCurSizeAllMemTables = @"rocksdb.cur-size-all-mem-tables";
+RocksDBIntPropertyName const RocksDBIntPropertySizeAllMemTables = @"rocksdb.size-all-mem-tables";
+RocksDBIntPropertyName const RocksDBIntPropertyNumEntriesActiveMemTable = @"rocksdb.num-entries-active-mem-table";
+RocksDBIntPropertyName const RocksDBIntPropertyNumEntriesImmMemTables = @"rocksdb.num-entries-imm-mem-tables";
+RocksDBIntPropertyName const RocksDBIntPropertyNumDeletesActiveMemTable = @"rocksdb.num-deletes-active-mem-table";
+RocksDBIntPropertyName const RocksDBIntPropertyNumDeletesImmMemTables = @"rocksdb.num-deletes-imm-mem-tables";
+RocksDBIntPropertyName const RocksDBIntPropertyEstimateNumKeys = @"rocksdb.estimate-num-keys";
+RocksDBIntPropertyName const RocksDBIntPropertyEstimateTableReadersMem = @"rocksdb.estimate-table-readers-mem";
+RocksDBIntPropertyName const RocksDBIntPropertyIsFileDeletionsEnabled = @"rocksdb.is-file-deletions-enabled";
+RocksDBIntPropertyName const RocksDBIntPropertyNumSnapshots = @"rocksdb.num-snapshots";
+RocksDBIntPropertyName const RocksDBIntPropertyOldestSnapshotTime = @"rocksdb.oldest-snapshot-time";
+RocksDBIntPropertyName const RocksDBIntPropertyOldestSnapshotSequence = @"rocksdb.oldest-snapshot-sequence";
+RocksDBIntPropertyName const RocksDBIntPropertyNumLiveVersions = @"rocksdb.num-live-versions";
+RocksDBIntPropertyName const RocksDBIntPropertyCurrentSuperVersionNumber = @"rocksdb.current-super-version-number";
+RocksDBIntPropertyName const RocksDBIntPropertyEstimateLiveDataSize = @"rocksdb.estimate-live-data-size";
+RocksDBIntPropertyName const RocksDBIntPropertyMinLogNumberToKeep = @"rocksdb.min-log-number-to-keep";
+RocksDBIntPropertyName const RocksDBIntPropertyMinObsoleteSstNumberToKeep = @"rocksdb.min-obsolete-sst-number-to-keep";
+RocksDBIntPropertyName const RocksDBIntPropertyTotalSstFilesSize = @"rocksdb.total-sst-files-size";
+RocksDBIntPropertyName const RocksDBIntPropertyLiveSstFilesSize = @"rocksdb.live-sst-files-size";
+RocksDBIntPropertyName const RocksDBIntPropertyBaseLevel = @"rocksdb.base-level";
+RocksDBIntPropertyName const RocksDBIntPropertyEstimatePendingCompactionBytes = @"rocksdb.estimate-pending-compaction-bytes";
+RocksDBIntPropertyName const RocksDBIntPropertyActualDelayedWriteRate = @"rocksdb.actual-delayed-write-rate";
+RocksDBIntPropertyName const RocksDBIntPropertyIsWriteStopped = @"rocksdb.is-write-stopped";
+RocksDBIntPropertyName const RocksDBIntPropertyEstimateOldestKeyTime = @"rocksdb.estimate-oldest-key-time";
+RocksDBIntPropertyName const RocksDBIntPropertyBlockCacheCapacity = @"rocksdb.block-cache-capacity";
+RocksDBIntPropertyName const RocksDBIntPropertyBlockCacheUsage = @"rocksdb.block-cache-usage";
+RocksDBIntPropertyName const RocksDBIntPropertyBlockCachePinnedUsage = @"rocksdb.block-cache-pinned-usage";
+RocksDBIntPropertyName const RocksDBIntPropertyNumBlobFiles = @"rocksdb.num-blob-files";
+RocksDBIntPropertyName const RocksDBIntPropertyTotalBlobFileSize = @"rocksdb.total-blob-file-size";
+RocksDBIntPropertyName const RocksDBIntPropertyLiveBlobFileSize = @"rocksdb.live-blob-file-size";
+
+#pragma mark - Map Properties
+
+RocksDBMapPropertyName const RocksDBMapPropertyCFStats = @"rocksdb.cfstats";
+RocksDBMapPropertyName const RocksDBMapPropertyDBStats = @"rocksdb.dbstats";
+RocksDBMapPropertyName const RocksDBMapPropertyBlockCacheEntryStats = @"rocksdb.block-cache-entry-stats";
+RocksDBMapPropertyName const RocksDBMapPropertyAggregatedTableProperties = @"rocksdb.aggregated-table-properties";
+
+#pragma mark - Int Property Table
+
+@interface RocksDBIntPropertyTable ()
+{
+	// Row-major, one row per property and one column per column family
+	std::vector<uint64_t> _values;
+	std::vector<bool> _available;
+	std::vector<uint64_t> _aggregated;
+}
+@property (nonatomic, copy) NSArray<RocksDBIntPropertyName> *properties;
+@property (nonatomic, copy) NSArray<RocksDBColumnFamilyHandle *> *columnFamilies;
+@end
+
+@implementation RocksDBIntPropertyTable
+@synthesize properties, columnFamilies;
+
+- (instancetype)initWithDB:(rocksdb::DB *)db
+				properties:(NSArray<RocksDBIntPropertyName> *)propertyNames
+			columnFamilies:(NSArray<RocksDBColumnFamilyHandle *> *)handles
+				aggregated:(BOOL)aggregated
+{
+	self = [super init];
+	if (self) {
+		self.properties = propertyNames;
+		self.columnFamilies = handles;
+
+		size_t rows = propertyNames.count;
+		size_t columns = handles.count;
+		_values.assign(rows * columns, 0);
+		_available.assign(rows * columns, false);
+		_aggregated.assign(rows, 0);
+
+		std::vector<rocksdb::ColumnFamilyHandle *> families;
+		families.reserve(columns);
+		for (RocksDBColumnFamilyHandle *handle in handles) {
+			families.push_back(handle.columnFamily);
+		}
+
+		for (size_t row = 0; row < rows; row++) {
+			std::string name = propertyNames[row].UTF8String;
+			for (size_t column = 0; column < columns; column++) {
+				uint64_t value = 0;
+				if (db->GetIntProperty(families[column], name, &value)) {
+					_values[row * columns + column] = value;
+					_available[row * columns + column] = true;
+				}
+			}
+
+			// Walks all column families of the DB again, hence opt-in
+			uint64_t value = 0;
+			if (aggregated && db->GetAggregatedIntProperty(name, &value)) {
+				_aggregated[row] = value;
+			}
+		}
+	}
+	return self;
+}
+
+- (uint64_t)valueAtRow:(NSUInteger)row column:(NSUInteger)column
+{
+	if (row >= self.properties.count || column >= self.columnFamilies.count) {
+		return 0;
+	}
+	return _values[row * self.columnFamilies.count + column];
+}
+
+- (BOOL)hasValueAtRow:(NSUInteger)row column:(NSUInteger)column
+{
+	if (row >= self.properties.count || column >= self.columnFamilies.count) {
+		return NO;
+	}
+	return _available[row * self.columnFamilies.count + column];
+}
+
+- (uint64_t)aggregatedValueAtRow:(NSUInteger)row
+{
+	if (row >= self.properties.count) {
+		return 0;
+	}
+	return _aggregated[row];
+}
+
+- (uint64_t)valueForProperty:(RocksDBIntPropertyName)property
+			  inColumnFamily:(RocksDBColumnFamilyHandle *)columnFamily
+{
+	NSUInteger row = [self.properties indexOfObject:property];
+	// Different handle objects may refer to the same column family
+	NSUInteger column = [self.columnFamilies indexOfObjectPassingTest:^BOOL(RocksDBColumnFamilyHandle *handle, NSUInteger idx, BOOL *stop) {
+		return handle.columnFamily->GetID() == columnFamily.columnFamily->GetID();
+	}];
+	if (row == NSNotFound || column == NSNotFound) {
+		return 0;
+	}
+	return [self valueAtRow:row column:column];
+}
+
+@end
@@ -0,0 +1,21 @@
+//
+//  RocksDBSizeApproximationOptions+Private.h
+//  ObjectiveRocks
+//
+
+#import "RocksDBSizeApproximationOptions.h"
+
+namespace rocksdb {
+	struct SizeApproximationOptions;
+}
+
+/**
+ This category is intended to hide all C++ types from the public interface in order to
+ maintain a pure Objective-C API for Swift compatibility.
+ */
+@interface RocksDBSizeApproximationOptions (Private)
+
+/** @brief The underlying rocksdb::SizeApproximationOptions associated with this instance. */
+@property (nonatomic, assign) rocksdb::SizeApproximationOptions options;
+
+@end
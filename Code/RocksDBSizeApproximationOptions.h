@@ -0,0 +1,38 @@
+//
+//  RocksDBSizeApproximationOptions.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The options used for approximating the size of key ranges.
+ */
+@interface RocksDBSizeApproximationOptions : NSObject
+
+/**
+ If true the approximation includes the data in the mem tables.
+ Default: false
+*/
+@property (nonatomic, assign) BOOL includeMemTables;
+
+/**
+ If true the approximation includes the data in the SST files.
+ Default: true
+*/
+@property (nonatomic, assign) BOOL includeFiles;
+
+/**
+ The allowed error margin for the size of the SST files, as a fraction of the total size of
+ the files overlapping the range. A positive value lets RocksDB skip inspecting the index blocks
+ of the files at the range boundaries, which makes the approximation considerably cheaper.
+ A negative value disables the margin and yields the most accurate approximation.
+ Default: -1.0
+*/
+@property (nonatomic, assign) double filesSizeErrorMargin;
+
+@end
+
+NS_ASSUME_NONNULL_END
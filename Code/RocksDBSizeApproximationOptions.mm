@@ -0,0 +1,63 @@
+//
+//  RocksDBSizeApproximationOptions.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBSizeApproximationOptions.h"
+
+#import <rocksdb/options.h>
+
+@interface RocksDBSizeApproximationOptions ()
+{
+	rocksdb::SizeApproximationOptions _options;
+}
+@property (nonatomic, assign) rocksdb::SizeApproximationOptions options;
+@end
+
+@implementation RocksDBSizeApproximationOptions
+@synthesize options = _options;
+
+#pragma mark - Lifecycle
+
+- (instancetype)init
+{
+	self = [super init];
+	if (self) {
+		_options = rocksdb::SizeApproximationOptions();
+	}
+	return self;
+}
+
+#pragma mark - Options
+
+- (BOOL)includeMemTables
+{
+	return _options.include_memtables;
+}
+
+- (void)setIncludeMemTables:(BOOL)includeMemTables
+{
+	_options.include_memtables = includeMemTables;
+}
+
+- (BOOL)includeFiles
+{
+	return _options.include_files;
+}
+
+- (void)setIncludeFiles:(BOOL)includeFiles
+{
+	_options.include_files = includeFiles;
+}
+
+- (double)filesSizeErrorMargin
+{
+	return _options.files_size_error_margin;
+}
+
+- (void)setFilesSizeErrorMargin:(double)filesSizeErrorMargin
+{
+	_options.files_size_error_margin = filesSizeErrorMargin;
+}
+
+@end
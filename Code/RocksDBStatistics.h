@@ -11,6 +11,8 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class RocksDBStatisticsSnapshot;
+
 typedef NS_ENUM(uint8_t, RocksDBStatsLevel)
 {
 	/** @brief Disable all metrics */
@@ -1062,6 +1064,16 @@ typedef NS_ENUM(uint32_t, RocksDBHistogram)
  */
 - (NSString *)histogramStringForType:(RocksDBHistogram)type;
 
+/**
+ Captures the current values of all tickers and histograms in a single pass. Two snapshots
+ can be compared to compute the change and rate of each ticker over the elapsed time.
+
+ @return A snapshot of all tickers and histograms.
+
+ @see RocksDBStatisticsSnapshot
+ */
+- (RocksDBStatisticsSnapshot *)snapshot;
+
 /** @brief String representation of the statistic object. */
 - (NSString *)description;
 
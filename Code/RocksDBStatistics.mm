@@ -5,6 +5,8 @@
 
 #import "RocksDBStatistics.h"
 #import "RocksDBError.h"
+#import "RocksDBStatisticsHistogram+Private.h"
+#import "RocksDBStatisticsSnapshot.h"
 
 #import <rocksdb/statistics.h>
 
@@ -17,17 +19,8 @@
 @property (nonatomic, assign) std::shared_ptr<rocksdb::Statistics> statistics;
 @end
 
-@interface RocksDBStatisticsHistogram ()
-@property (nonatomic, copy) NSString *ticker;
-@property (nonatomic, assign) double median;
-@property (nonatomic, assign) double percentile95;
-@property (nonatomic, assign) double percentile99;
-@property (nonatomic, assign) double average;
-@property (nonatomic, assign) double standardDeviation;
-@property (nonatomic, assign) double max;
-@property (nonatomic, assign) uint64_t count;
-@property (nonatomic, assign) uint64_t sum;
-@property (nonatomic, assign) double min;
+@interface RocksDBStatisticsSnapshot ()
+- (instancetype)initWithStatistics:(const std::shared_ptr<rocksdb::Statistics> &)statistics;
 @end
 
 #pragma mark - Impl
@@ -82,18 +75,25 @@
 	switch (statsLevel) {
 		case RocksDBStatsLevelDisableAll:
 			_statistics->set_stats_level(rocksdb::kDisableAll);
+			break;
 		case RocksDBStatsLevelExceptTickers:
 			_statistics->set_stats_level(rocksdb::kExceptTickers);
+			break;
 		case RocksDBStatsLevelExceptHistogramOrTimers:
 			_statistics->set_stats_level(rocksdb::kExceptHistogramOrTimers);
+			break;
 		case RocksDBStatsLevelExceptTimers:
 			_statistics->set_stats_level(rocksdb::kExceptTimers);
+			break;
 		case RocksDBStatsLevelExceptDetailedTimers:
 			_statistics->set_stats_level(rocksdb::kExceptDetailedTimers);
+			break;
 		case RocksDBStatsLevelExceptTimeForMutex:
 			_statistics->set_stats_level(rocksdb::kExceptTimeForMutex);
+			break;
 		case RocksDBStatsLevelAll:
 			_statistics->set_stats_level(rocksdb::kAll);
+			break;
 	}
 }
 
@@ -115,27 +115,18 @@
 
 - (RocksDBStatisticsHistogram *)histogramDataForType:(RocksDBHistogram)ticker
 {
-	rocksdb::HistogramData *data = new rocksdb::HistogramData;
-	_statistics->histogramData(ticker, data);
-
-	RocksDBStatisticsHistogram *histogram = [RocksDBStatisticsHistogram new];
+	rocksdb::HistogramData data;
+	_statistics->histogramData(ticker, &data);
 
 	std::string tickerName = rocksdb::HistogramsNameMap[ticker].second;
+	NSString *name = [NSString stringWithCString:tickerName.c_str() encoding:NSUTF8StringEncoding];
 
-	histogram.ticker = [NSString stringWithCString:tickerName.c_str() encoding:NSUTF8StringEncoding];
-	histogram.median = data->median;
-	histogram.percentile95 = data->percentile95;
-	histogram.percentile95 = data->percentile99;
-	histogram.average = data->average;
-	histogram.standardDeviation = data->standard_deviation;
-	histogram.max = data->max;
-	histogram.count = data->count;
-	histogram.sum = data->sum;
-	histogram.min = data->min;
-
-	delete data;
+	return [[RocksDBStatisticsHistogram alloc] initWithHistogramData:data name:name];
+}
 
-	return histogram;
+- (RocksDBStatisticsSnapshot *)snapshot
+{
+	return [[RocksDBStatisticsSnapshot alloc] initWithStatistics:_statistics];
 }
 
 - (BOOL)reset:(NSError *__autoreleasing  _Nullable *)error
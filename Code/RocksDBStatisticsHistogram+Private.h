@@ -0,0 +1,24 @@
+//
+//  RocksDBStatisticsHistogram+Private.h
+//  ObjectiveRocks
+//
+
+#import "RocksDBStatisticsHistogram.h"
+
+namespace rocksdb {
+	struct HistogramData;
+}
+
+/**
+ This category is intended to hide all C++ types from the public interface in order to
+ maintain a pure Objective-C API for Swift compatibility.
+ */
+@interface RocksDBStatisticsHistogram (Private)
+
+/**
+ Initializes a new instance of `RocksDBStatisticsHistogram` with the given
+ rocksdb::HistogramData and histogram name.
+ */
+- (instancetype)initWithHistogramData:(const rocksdb::HistogramData &)data name:(NSString *)name;
+
+@end
@@ -7,6 +7,9 @@
 //
 
 #import "RocksDBStatisticsHistogram.h"
+#import "RocksDBStatisticsHistogram+Private.h"
+
+#import <rocksdb/statistics.h>
 
 @interface RocksDBStatisticsHistogram ()
 @property (nonatomic, copy) NSString *ticker;
@@ -24,6 +27,24 @@
 @implementation RocksDBStatisticsHistogram
 @synthesize ticker, median, percentile95, percentile99, average, standardDeviation;
 
+- (instancetype)initWithHistogramData:(const rocksdb::HistogramData &)data name:(NSString *)name
+{
+	self = [super init];
+	if (self) {
+		self.ticker = name;
+		self.median = data.median;
+		self.percentile95 = data.percentile95;
+		self.percentile99 = data.percentile99;
+		self.average = data.average;
+		self.standardDeviation = data.standard_deviation;
+		self.max = data.max;
+		self.count = data.count;
+		self.sum = data.sum;
+		self.min = data.min;
+	}
+	return self;
+}
+
 - (NSString *)description
 {
 	return [NSString stringWithFormat:@"<Histogram Type: %@, Median: %f, Percentile 95: %f, Percentile 99: %f, Average: %f, Standard Deviation: %f, Min: %f, Max: %f, Count: %llu, Sum: %llu>",
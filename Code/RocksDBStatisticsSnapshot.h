@@ -0,0 +1,102 @@
+//
+//  RocksDBStatisticsSnapshot.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+#import "RocksDBStatistics.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDBStatisticsDelta;
+
+/**
+ An immutable point-in-time copy of all tickers and histograms of a `RocksDBStatistics`,
+ captured in a single pass.
+
+ @see RocksDBStatistics
+ @see RocksDBStatisticsDelta
+ */
+@interface RocksDBStatisticsSnapshot : NSObject
+
+/** @brief The time the snapshot was taken, in seconds of system uptime. */
+@property (nonatomic, readonly) NSTimeInterval timestamp;
+
+/**
+ Returns the value of the given ticker at the time of the snapshot.
+
+ @param ticker The ticker type to get.
+ @return The value for the given ticker type.
+ */
+- (uint64_t)countForTicker:(RocksDBTicker)ticker;
+
+/**
+ Returns the histogram for the given histogram type at the time of the snapshot.
+
+ @param type The type of the histogram to get.
+ @return The value for the given histogram type.
+ */
+- (RocksDBStatisticsHistogram *)histogramDataForType:(RocksDBHistogram)type;
+
+/**
+ Enumerates all tickers of the snapshot.
+
+ @param block The block to apply to each ticker, with the ticker type, its RocksDB name
+ (e.g. "rocksdb.block.cache.miss") and its value.
+ */
+- (void)enumerateTickersUsingBlock:(void (^)(RocksDBTicker ticker, NSString *name, uint64_t count))block;
+
+/**
+ Enumerates all histograms of the snapshot.
+
+ @param block The block to apply to each histogram, with the histogram type and its data.
+ */
+- (void)enumerateHistogramsUsingBlock:(void (^)(RocksDBHistogram type, RocksDBStatisticsHistogram *histogram))block;
+
+/**
+ Computes the change of all tickers and histogram counts since the given earlier snapshot.
+
+ @param snapshot An earlier snapshot of the same statistics object.
+ @return The delta between the given snapshot and this one.
+ */
+- (RocksDBStatisticsDelta *)deltaSinceSnapshot:(RocksDBStatisticsSnapshot *)snapshot;
+
+@end
+
+/**
+ The change of the statistics between two snapshots. Counts that decreased, e.g. because the
+ statistics were reset in between, are reported as 0.
+
+ @see RocksDBStatisticsSnapshot
+ */
+@interface RocksDBStatisticsDelta : NSObject
+
+/** @brief The time elapsed between the two snapshots, in seconds. */
+@property (nonatomic, readonly) NSTimeInterval interval;
+
+/** @brief The change of the given ticker. */
+- (uint64_t)countForTicker:(RocksDBTicker)ticker;
+
+/** @brief The change of the given ticker per second, 0 if no time elapsed. */
+- (double)rateForTicker:(RocksDBTicker)ticker;
+
+/** @brief The number of values recorded in the given histogram in the interval. */
+- (uint64_t)countForHistogram:(RocksDBHistogram)type;
+
+/** @brief The sum of the values recorded in the given histogram in the interval. */
+- (uint64_t)sumForHistogram:(RocksDBHistogram)type;
+
+/** @brief The average of the values recorded in the given histogram in the interval. */
+- (double)averageForHistogram:(RocksDBHistogram)type;
+
+/**
+ Enumerates the change of all tickers.
+
+ @param block The block to apply to each ticker, with the ticker type, its RocksDB name
+ and its change.
+ */
+- (void)enumerateTickersUsingBlock:(void (^)(RocksDBTicker ticker, NSString *name, uint64_t count))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
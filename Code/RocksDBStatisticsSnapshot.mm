@@ -0,0 +1,168 @@
+//
+//  RocksDBStatisticsSnapshot.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBStatisticsSnapshot.h"
+#import "RocksDBStatisticsHistogram+Private.h"
+
+#import <rocksdb/statistics.h>
+
+#include <vector>
+
+static NSString * TickerName(uint32_t ticker)
+{
+	return [NSString stringWithCString:rocksdb::TickersNameMap[ticker].second.c_str() encoding:NSUTF8StringEncoding];
+}
+
+static NSString * HistogramName(uint32_t type)
+{
+	return [NSString stringWithCString:rocksdb::HistogramsNameMap[type].second.c_str() encoding:NSUTF8StringEncoding];
+}
+
+@interface RocksDBStatisticsDelta ()
+{
+	NSTimeInterval _interval;
+	std::vector<uint64_t> _tickers;
+	std::vector<uint64_t> _histogramCounts;
+	std::vector<uint64_t> _histogramSums;
+}
+- (instancetype)initWithInterval:(NSTimeInterval)interval;
+@end
+
+#pragma mark - Snapshot
+
+@interface RocksDBStatisticsSnapshot ()
+{
+	NSTimeInterval _timestamp;
+	std::vector<uint64_t> _tickers;
+	std::vector<rocksdb::HistogramData> _histograms;
+}
+@end
+
+@implementation RocksDBStatisticsSnapshot
+@synthesize timestamp = _timestamp;
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithStatistics:(const std::shared_ptr<rocksdb::Statistics> &)statistics
+{
+	self = [super init];
+	if (self) {
+		_timestamp = [NSProcessInfo processInfo].systemUptime;
+
+		_tickers.resize(rocksdb::TICKER_ENUM_MAX);
+		for (uint32_t ticker = 0; ticker < rocksdb::TICKER_ENUM_MAX; ticker++) {
+			_tickers[ticker] = statistics->getTickerCount(ticker);
+		}
+
+		_histograms.resize(rocksdb::HISTOGRAM_ENUM_MAX);
+		for (uint32_t type = 0; type < rocksdb::HISTOGRAM_ENUM_MAX; type++) {
+			statistics->histogramData(type, &_histograms[type]);
+		}
+	}
+	return self;
+}
+
+#pragma mark - Accessors
+
+- (uint64_t)countForTicker:(RocksDBTicker)ticker
+{
+	return ticker < _tickers.size() ? _tickers[ticker] : 0;
+}
+
+- (RocksDBStatisticsHistogram *)histogramDataForType:(RocksDBHistogram)type
+{
+	rocksdb::HistogramData data = type < _histograms.size() ? _histograms[type] : rocksdb::HistogramData();
+	return [[RocksDBStatisticsHistogram alloc] initWithHistogramData:data name:HistogramName(type)];
+}
+
+- (void)enumerateTickersUsingBlock:(void (^)(RocksDBTicker ticker, NSString *name, uint64_t count))block
+{
+	for (uint32_t ticker = 0; ticker < _tickers.size(); ticker++) {
+		block((RocksDBTicker)ticker, TickerName(ticker), _tickers[ticker]);
+	}
+}
+
+- (void)enumerateHistogramsUsingBlock:(void (^)(RocksDBHistogram type, RocksDBStatisticsHistogram *histogram))block
+{
+	for (uint32_t type = 0; type < _histograms.size(); type++) {
+		block((RocksDBHistogram)type, [[RocksDBStatisticsHistogram alloc] initWithHistogramData:_histograms[type]
+																						   name:HistogramName(type)]);
+	}
+}
+
+#pragma mark - Delta
+
+- (RocksDBStatisticsDelta *)deltaSinceSnapshot:(RocksDBStatisticsSnapshot *)snapshot
+{
+	RocksDBStatisticsDelta *delta = [[RocksDBStatisticsDelta alloc] initWithInterval:_timestamp - snapshot->_timestamp];
+
+	delta->_tickers.resize(_tickers.size());
+	for (size_t i = 0; i < _tickers.size(); i++) {
+		uint64_t previous = i < snapshot->_tickers.size() ? snapshot->_tickers[i] : 0;
+		delta->_tickers[i] = _tickers[i] > previous ? _tickers[i] - previous : 0;
+	}
+
+	delta->_histogramCounts.resize(_histograms.size());
+	delta->_histogramSums.resize(_histograms.size());
+	for (size_t i = 0; i < _histograms.size(); i++) {
+		const rocksdb::HistogramData &current = _histograms[i];
+		rocksdb::HistogramData previous = i < snapshot->_histograms.size() ? snapshot->_histograms[i] : rocksdb::HistogramData();
+		delta->_histogramCounts[i] = current.count > previous.count ? current.count - previous.count : 0;
+		delta->_histogramSums[i] = current.sum > previous.sum ? current.sum - previous.sum : 0;
+	}
+
+	return delta;
+}
+
+@end
+
+#pragma mark - Delta
+
+@implementation RocksDBStatisticsDelta
+@synthesize interval = _interval;
+
+- (instancetype)initWithInterval:(NSTimeInterval)interval
+{
+	self = [super init];
+	if (self) {
+		_interval = interval;
+	}
+	return self;
+}
+
+- (uint64_t)countForTicker:(RocksDBTicker)ticker
+{
+	return ticker < _tickers.size() ? _tickers[ticker] : 0;
+}
+
+- (double)rateForTicker:(RocksDBTicker)ticker
+{
+	return _interval > 0 ? [self countForTicker:ticker] / _interval : 0;
+}
+
+- (uint64_t)countForHistogram:(RocksDBHistogram)type
+{
+	return type < _histogramCounts.size() ? _histogramCounts[type] : 0;
+}
+
+- (uint64_t)sumForHistogram:(RocksDBHistogram)type
+{
+	return type < _histogramSums.size() ? _histogramSums[type] : 0;
+}
+
+- (double)averageForHistogram:(RocksDBHistogram)type
+{
+	uint64_t count = [self countForHistogram:type];
+	return count > 0 ? (double)[self sumForHistogram:type] / count : 0;
+}
+
+- (void)enumerateTickersUsingBlock:(void (^)(RocksDBTicker ticker, NSString *name, uint64_t count))block
+{
+	for (uint32_t ticker = 0; ticker < _tickers.size(); ticker++) {
+		block((RocksDBTicker)ticker, TickerName(ticker), _tickers[ticker]);
+	}
+}
+
+@end
@@ -0,0 +1,36 @@
+//
+//  RocksDBStatsHistory.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+#import "RocksDBStatistics.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A single entry of the stats history of a DB, holding the change of every ticker during one
+ `statsPersistPeriodSec` period.
+
+ @see -[RocksDB statsHistoryFrom:to:error:]
+ */
+@interface RocksDBStatsHistoryEntry : NSObject
+
+/** @brief The time at the end of the period. */
+@property (nonatomic, strong, readonly) NSDate *date;
+
+/** @brief The length of the period in seconds. */
+@property (nonatomic, readonly) NSTimeInterval interval;
+
+/** @brief The change of each ticker during the period, keyed by the RocksDB ticker name. */
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, NSNumber *> *tickers;
+
+/** @brief The change of the given ticker during the period. */
+- (uint64_t)countForTicker:(RocksDBTicker)ticker;
+
+/** @brief The change of the given ticker per second during the period. */
+- (double)rateForTicker:(RocksDBTicker)ticker;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,50 @@
+//
+//  RocksDBStatsHistory.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBStatsHistory.h"
+
+#import <rocksdb/statistics.h>
+
+@implementation RocksDBStatsHistoryEntry
+
+- (instancetype)initWithTime:(uint64_t)time
+					interval:(NSTimeInterval)interval
+					 tickers:(const std::map<std::string, uint64_t> &)tickers
+{
+	self = [super init];
+	if (self) {
+		_date = [NSDate dateWithTimeIntervalSince1970:time];
+		_interval = interval;
+
+		NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:tickers.size()];
+		for (const auto &entry : tickers) {
+			dictionary[[NSString stringWithUTF8String:entry.first.c_str()]] = @(entry.second);
+		}
+		_tickers = dictionary;
+	}
+	return self;
+}
+
+- (uint64_t)countForTicker:(RocksDBTicker)ticker
+{
+	if (ticker >= rocksdb::TickersNameMap.size()) {
+		return 0;
+	}
+	NSString *name = [NSString stringWithUTF8String:rocksdb::TickersNameMap[ticker].second.c_str()];
+	return _tickers[name].unsignedLongLongValue;
+}
+
+- (double)rateForTicker:(RocksDBTicker)ticker
+{
+	return _interval > 0 ? [self countForTicker:ticker] / _interval : 0;
+}
+
+- (NSString *)description
+{
+	return [NSString stringWithFormat:@"<StatsHistoryEntry Date: %@, Interval: %f, Tickers: %lu>",
+			_date, _interval, (unsigned long)_tickers.count];
+}
+
+@end
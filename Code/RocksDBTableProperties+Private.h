@@ -0,0 +1,24 @@
+//
+//  RocksDBTableProperties+Private.h
+//  ObjectiveRocks
+//
+
+#import "RocksDBTableProperties.h"
+
+namespace rocksdb {
+	struct TableProperties;
+}
+
+/**
+ This category is intended to hide all C++ types from the public interface in order to
+ maintain a pure Objective-C API for Swift compatibility.
+ */
+@interface RocksDBTableProperties (Private)
+
+/**
+ Initializes a new instance of `RocksDBTableProperties` with the given
+ rocksdb::TableProperties
+ */
+- (instancetype)initWithTableProperties:(const rocksdb::TableProperties &)properties;
+
+@end
@@ -0,0 +1,73 @@
+//
+//  RocksDBTableProperties.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The properties of a single SST file, including the user-collected properties gathered
+ by the table properties collectors configured on the Column Family.
+
+ @see RocksDBTablePropertiesCollectorFactory
+ */
+@interface RocksDBTableProperties : NSObject
+
+/** @brief The name of the Column Family this file belongs to. */
+@property (nonatomic, copy, readonly) NSString *columnFamilyName;
+
+/** @brief The total size of all data blocks. */
+@property (nonatomic, readonly) uint64_t dataSize;
+
+/** @brief The size of the index block. */
+@property (nonatomic, readonly) uint64_t indexSize;
+
+/** @brief The size of the filter block. */
+@property (nonatomic, readonly) uint64_t filterSize;
+
+/** @brief The total raw key size. */
+@property (nonatomic, readonly) uint64_t rawKeySize;
+
+/** @brief The total raw value size. */
+@property (nonatomic, readonly) uint64_t rawValueSize;
+
+/** @brief The number of data blocks in this table. */
+@property (nonatomic, readonly) uint64_t numDataBlocks;
+
+/** @brief The number of entries in this table. */
+@property (nonatomic, readonly) uint64_t numEntries;
+
+/** @brief The number of deletions in this table. */
+@property (nonatomic, readonly) uint64_t numDeletions;
+
+/** @brief The number of merge operands in this table. */
+@property (nonatomic, readonly) uint64_t numMergeOperands;
+
+/** @brief The number of range deletions in this table. */
+@property (nonatomic, readonly) uint64_t numRangeDeletions;
+
+/** @brief The time in seconds since the epoch when the file was created, or 0 if unknown. */
+@property (nonatomic, readonly) uint64_t creationTime;
+
+/** @brief The properties gathered by the user-defined collectors. */
+@property (nonatomic, strong, readonly) NSDictionary<NSString *, NSData *> *userCollectedProperties;
+
+/** @brief The human-readable form of the properties gathered by the user-defined collectors. */
+@property (nonatomic, strong, readonly) NSDictionary<NSString *, NSString *> *readableProperties;
+
+/**
+ Returns the number of keys with the given prefix in this table, as recorded by the
+ prefix count collector.
+
+ @param prefix The key prefix, with the length the collector was configured with.
+ @return The number of keys with the given prefix, or 0 if the table has no such keys.
+
+ @see +[RocksDBTablePropertiesCollectorFactory prefixCountCollectorFactoryWithPrefixLength:]
+ */
+- (uint64_t)countForPrefix:(NSData *)prefix;
+
+@end
+
+NS_ASSUME_NONNULL_END
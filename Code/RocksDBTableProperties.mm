@@ -0,0 +1,69 @@
+//
+//  RocksDBTableProperties.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBTableProperties.h"
+#import "RocksDBTableProperties+Private.h"
+#import "RocksDBPrefixTablePropertiesCollector.h"
+
+#import <rocksdb/table_properties.h>
+
+@implementation RocksDBTableProperties
+
+- (instancetype)initWithTableProperties:(const rocksdb::TableProperties &)properties
+{
+	self = [super init];
+	if (self) {
+		self->_columnFamilyName = [NSString stringWithCString:properties.column_family_name.c_str() encoding:NSUTF8StringEncoding];
+		self->_dataSize = properties.data_size;
+		self->_indexSize = properties.index_size;
+		self->_filterSize = properties.filter_size;
+		self->_rawKeySize = properties.raw_key_size;
+		self->_rawValueSize = properties.raw_value_size;
+		self->_numDataBlocks = properties.num_data_blocks;
+		self->_numEntries = properties.num_entries;
+		self->_numDeletions = properties.num_deletions;
+		self->_numMergeOperands = properties.num_merge_operands;
+		self->_numRangeDeletions = properties.num_range_deletions;
+		self->_creationTime = properties.creation_time;
+
+		NSMutableDictionary *userCollected = [NSMutableDictionary dictionary];
+		for (auto const &entry : properties.user_collected_properties) {
+			NSString *key = [NSString stringWithUTF8String:entry.first.c_str()];
+			userCollected[key] = [NSData dataWithBytes:entry.second.data() length:entry.second.size()];
+		}
+		self->_userCollectedProperties = userCollected;
+
+		NSMutableDictionary *readable = [NSMutableDictionary dictionary];
+		for (auto const &entry : properties.readable_properties) {
+			NSString *key = [NSString stringWithUTF8String:entry.first.c_str()];
+			NSString *value = [[NSString alloc] initWithBytes:entry.second.data()
+													   length:entry.second.size()
+													 encoding:NSUTF8StringEncoding];
+			if (value != nil) {
+				readable[key] = value;
+			}
+		}
+		self->_readableProperties = readable;
+	}
+	return self;
+}
+
+- (uint64_t)countForPrefix:(NSData *)prefix
+{
+	NSMutableString *name = [NSMutableString stringWithUTF8String:kRocksDBPrefixCountPropertyPrefix];
+	const unsigned char *bytes = (const unsigned char *)prefix.bytes;
+	for (NSUInteger i = 0; i < prefix.length; i++) {
+		[name appendFormat:@"%02x", bytes[i]];
+	}
+
+	NSData *value = _userCollectedProperties[name];
+	if (value == nil) {
+		return 0;
+	}
+	NSString *count = [[NSString alloc] initWithData:value encoding:NSUTF8StringEncoding];
+	return strtoull(count.UTF8String, NULL, 10);
+}
+
+@end
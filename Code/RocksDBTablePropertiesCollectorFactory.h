@@ -0,0 +1,68 @@
+//
+//  RocksDBTablePropertiesCollectorFactory.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A factory for the collectors that gather user-defined properties while SST files are built.
+ The collected properties are stored in the table properties block of every SST file and can
+ be read back via `-[RocksDB propertiesOfAllTables:]` and `-[RocksDB propertiesOfTablesInRanges:error:]`.
+
+ @see RocksDBTableProperties
+ */
+@interface RocksDBTablePropertiesCollectorFactory : NSObject
+
+/** @brief The name of the collector factory. */
+@property (nonatomic, copy, readonly) NSString *name;
+
+/**
+ Returns a native collector factory that counts the keys sharing the same fixed-length prefix.
+
+ Each distinct prefix in an SST file is recorded as a user-collected property named
+ `objectiverocks.prefix.count.<hex-encoded prefix>` with the decimal key count as value.
+ Keys shorter than `prefixLength` are counted under the full key. Deletions are not counted.
+
+ @param prefixLength The length of the prefix in bytes.
+ @return A newly-initialized collector factory.
+
+ @see -[RocksDBTableProperties countForPrefix:]
+ */
++ (instancetype)prefixCountCollectorFactoryWithPrefixLength:(size_t)prefixLength;
+
+/**
+ Returns the native collector factory that marks an SST file for compaction when it
+ contains at least `deletionTrigger` deletion entries in any sliding window of
+ `windowSize` consecutive entries, or when the ratio of deletions in the whole file
+ reaches `deletionRatio`.
+
+ @param windowSize The size of the sliding window.
+ @param deletionTrigger The number of deletions in a window that trigger the compaction.
+ @param deletionRatio The ratio of deletions in the file that triggers the compaction, 0 to disable.
+ @return A newly-initialized collector factory.
+ */
++ (instancetype)compactOnDeletionCollectorFactoryWithWindowSize:(size_t)windowSize
+												deletionTrigger:(size_t)deletionTrigger
+												  deletionRatio:(double)deletionRatio;
+
+/**
+ Returns a collector factory that calls the given block for each Put and Merge entry
+ added to an SST file.
+
+ Each SST file being built gets its own mutable properties dictionary, which is passed to
+ every block invocation and stored as the file's user-collected properties once the file
+ is finished. The block may be called concurrently for different files from background threads.
+
+ @param name The name of the collector.
+ @param block The block to call for each entry.
+ @return A newly-initialized collector factory.
+ */
++ (instancetype)collectorFactoryWithName:(NSString *)name
+								addBlock:(void (^)(NSData *key, NSData *value, NSMutableDictionary<NSString *, NSData *> *properties))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,116 @@
+//
+//  RocksDBTablePropertiesCollectorFactory.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBTablePropertiesCollectorFactory.h"
+#import "RocksDBSlice+Private.h"
+#import "RocksDBCallbackTablePropertiesCollector.h"
+#import "RocksDBPrefixTablePropertiesCollector.h"
+
+#import <rocksdb/table_properties.h>
+#import <rocksdb/utilities/table_properties_collectors.h>
+
+@interface RocksDBTablePropertiesCollectorFactory ()
+{
+	NSString *_name;
+	void (^_addBlock)(NSData *, NSData *, NSMutableDictionary<NSString *, NSData *> *);
+	std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> _collectorFactory;
+}
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, assign) std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> collectorFactory;
+@end
+
+@implementation RocksDBTablePropertiesCollectorFactory
+@synthesize name = _name;
+@synthesize collectorFactory = _collectorFactory;
+
+#pragma mark - Lifecycle
+
++ (instancetype)prefixCountCollectorFactoryWithPrefixLength:(size_t)prefixLength
+{
+	std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> factory(RocksDBPrefixTablePropertiesCollectorFactory(prefixLength));
+	return [[self alloc] initWithNativeCollectorFactory:factory];
+}
+
++ (instancetype)compactOnDeletionCollectorFactoryWithWindowSize:(size_t)windowSize
+												deletionTrigger:(size_t)deletionTrigger
+												  deletionRatio:(double)deletionRatio
+{
+	std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> factory =
+		rocksdb::NewCompactOnDeletionCollectorFactory(windowSize, deletionTrigger, deletionRatio);
+	return [[self alloc] initWithNativeCollectorFactory:factory];
+}
+
++ (instancetype)collectorFactoryWithName:(NSString *)name
+								addBlock:(void (^)(NSData *, NSData *, NSMutableDictionary<NSString *, NSData *> *))block
+{
+	return [[self alloc] initWithName:name addBlock:block];
+}
+
+- (instancetype)initWithNativeCollectorFactory:(std::shared_ptr<rocksdb::TablePropertiesCollectorFactory>)collectorFactory
+{
+	self = [super init];
+	if (self) {
+		_name = [NSString stringWithCString:collectorFactory->Name() encoding:NSUTF8StringEncoding];
+		_collectorFactory = collectorFactory;
+	}
+	return self;
+}
+
+- (instancetype)initWithName:(NSString *)name
+					addBlock:(void (^)(NSData *, NSData *, NSMutableDictionary<NSString *, NSData *> *))block
+{
+	self = [super init];
+	if (self) {
+		_name = [name copy];
+		_addBlock = [block copy];
+		_collectorFactory.reset(RocksDBCallbackTablePropertiesCollectorFactory((__bridge void *)self,
+																			   _name.UTF8String,
+																			   &trampolineStartCollector,
+																			   &trampolineAddToCollector,
+																			   &trampolineFinishCollector,
+																			   &trampolineReleaseCollector));
+	}
+	return self;
+}
+
+#pragma mark - Callbacks
+
+void* trampolineStartCollector(void* instance)
+{
+	return (__bridge_retained void *)[NSMutableDictionary dictionary];
+}
+
+void trampolineAddToCollector(void* instance, void* state, const rocksdb::Slice& key, const rocksdb::Slice& value)
+{
+	@autoreleasepool {
+		[(__bridge id)instance addKey:key value:value toProperties:(__bridge NSMutableDictionary *)state];
+	}
+}
+
+void trampolineFinishCollector(void* instance, void* state, rocksdb::UserCollectedProperties* properties)
+{
+	NSDictionary<NSString *, NSData *> *collected = (__bridge NSMutableDictionary *)state;
+	for (NSString *key in collected) {
+		NSData *value = collected[key];
+		(*properties)[key.UTF8String] = std::string((const char *)value.bytes, value.length);
+	}
+}
+
+void trampolineReleaseCollector(void* instance, void* state)
+{
+	NSMutableDictionary *collected = (__bridge_transfer NSMutableDictionary *)state;
+	collected = nil;
+}
+
+- (void)addKey:(const rocksdb::Slice &)keySlice
+		 value:(const rocksdb::Slice &)valueSlice
+  toProperties:(NSMutableDictionary<NSString *, NSData *> *)properties
+{
+	if (_addBlock) {
+		_addBlock(DataFromSlice(keySlice), DataFromSlice(valueSlice), properties);
+	}
+}
+
+@end
@@ -0,0 +1,23 @@
+//
+//  RocksDBThreadStatus+Private.h
+//  ObjectiveRocks
+//
+
+#import "RocksDBThreadStatus.h"
+
+namespace rocksdb {
+	struct ThreadStatus;
+}
+
+/**
+ This category is intended to hide all C++ types from the public interface in order to
+ maintain a pure Objective-C API for Swift compatibility.
+ */
+@interface RocksDBThreadStatus (Private)
+
+/**
+ Initializes a new instance of `RocksDBThreadStatus` with the given rocksdb::ThreadStatus.
+ */
+- (instancetype)initWithThreadStatus:(const rocksdb::ThreadStatus &)status;
+
+@end
@@ -20,7 +20,10 @@ typedef NS_ENUM(int, RocksDBThreadType)
 	RocksDBThreadLowPiority,
 
 	/** @brief User thread (Non-RocksDB background thread). */
-	RocksDBThreadUser
+	RocksDBThreadUser,
+
+	/** @brief RocksDB background thread in bottom priority thread pool. */
+	RocksDBThreadBottomPriority
 };
 
 /** 
@@ -35,7 +38,62 @@ typedef NS_ENUM(int, RocksDBOperationType)
 	RocksDBOperationCompaction,
 
 	/** A flush operation. */
-	RocksDBOperationFlush
+	RocksDBOperationFlush,
+
+	/** Opening the database. */
+	RocksDBOperationDBOpen,
+
+	/** A point lookup. */
+	RocksDBOperationGet,
+
+	/** A batched point lookup. */
+	RocksDBOperationMultiGet,
+
+	/** An iterator operation. */
+	RocksDBOperationDBIterator,
+
+	/** Verifying the checksums of the database. */
+	RocksDBOperationVerifyDBChecksum,
+
+	/** Verifying the file checksums of the database. */
+	RocksDBOperationVerifyFileChecksums
+};
+
+/** The stage of the current operation of a thread. */
+typedef NS_ENUM(int, RocksDBOperationStage)
+{
+	/** Unknown stage. */
+	RocksDBOperationStageUnknown = 0,
+
+	/** Running a flush job. */
+	RocksDBOperationStageFlushRun,
+
+	/** Writing the level-0 table of a flush. */
+	RocksDBOperationStageFlushWriteL0,
+
+	/** Preparing a compaction job. */
+	RocksDBOperationStageCompactionPrepare,
+
+	/** Running a compaction job. */
+	RocksDBOperationStageCompactionRun,
+
+	/** Processing the key-values of a compaction. */
+	RocksDBOperationStageCompactionProcessKV,
+
+	/** Installing the results of a compaction. */
+	RocksDBOperationStageCompactionInstall,
+
+	/** Syncing the output files of a compaction. */
+	RocksDBOperationStageCompactionSyncFile,
+
+	/** Picking the memtables to flush. */
+	RocksDBOperationStagePickMemTablesToFlush,
+
+	/** Rolling back a failed memtable flush. */
+	RocksDBOperationStageMemTableRollback,
+
+	/** Installing the results of a memtable flush. */
+	RocksDBOperationStageMemTableInstallFlushResults
 };
 
 /** The type used to refer to a thread state. */
@@ -43,6 +101,9 @@ typedef NS_ENUM(int, RocksDBStateType)
 {
 	/** Unkown state. */
 	RocksDBStateUnknown = 0,
+
+	/** Waiting on a mutex. */
+	RocksDBStateMutexWait
 };
 
 /**
@@ -70,6 +131,39 @@ typedef NS_ENUM(int, RocksDBStateType)
 /** @brief The state (lower-level action) that the current thread is involved. */
 @property (nonatomic, assign, readonly) RocksDBStateType stateType;
 
+/** @brief The elapsed time of the current operation in microseconds. */
+@property (nonatomic, assign, readonly) uint64_t operationElapsedMicros;
+
+/** @brief The stage of the current operation. */
+@property (nonatomic, assign, readonly) RocksDBOperationStage operationStage;
+
+/** @brief The properties of the current operation keyed by their RocksDB names, e.g. "BytesRead". */
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, NSNumber *> *operationProperties;
+
+/** @brief The ID of the current flush or compaction job. */
+@property (nonatomic, assign, readonly) uint64_t jobId;
+
+/** @brief The total input bytes of the current compaction, or the memtable bytes of the current flush. */
+@property (nonatomic, assign, readonly) uint64_t totalInputBytes;
+
+/** @brief The bytes read so far by the current compaction. */
+@property (nonatomic, assign, readonly) uint64_t bytesRead;
+
+/** @brief The bytes written so far by the current flush or compaction. */
+@property (nonatomic, assign, readonly) uint64_t bytesWritten;
+
+/** @brief The base input level of the current compaction, or -1 for other operations. */
+@property (nonatomic, assign, readonly) int inputLevel;
+
+/** @brief The output level of the current compaction, or -1 for other operations. */
+@property (nonatomic, assign, readonly) int outputLevel;
+
+/** @brief Whether the current compaction was requested manually. */
+@property (nonatomic, assign, readonly, getter=isManualCompaction) BOOL manualCompaction;
+
+/** @brief The fraction in [0, 1] of the input the current compaction has read, or 0 if unknown. */
+@property (nonatomic, assign, readonly) double progress;
+
 @end
 
 NS_ASSUME_NONNULL_END
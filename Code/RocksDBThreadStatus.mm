@@ -7,6 +7,9 @@
 //
 
 #import "RocksDBThreadStatus.h"
+#import "RocksDBThreadStatus+Private.h"
+
+#import <rocksdb/thread_status.h>
 
 @interface RocksDBThreadStatus ()
 @property (nonatomic, assign) uint64_t threadId;
@@ -15,8 +18,75 @@
 @property (nonatomic, copy) NSString *columnFamilyname;
 @property (nonatomic, assign) RocksDBOperationType operationType;
 @property (nonatomic, assign) RocksDBStateType stateType;
+@property (nonatomic, assign) uint64_t operationElapsedMicros;
+@property (nonatomic, assign) RocksDBOperationStage operationStage;
+@property (nonatomic, copy) NSDictionary<NSString *, NSNumber *> *operationProperties;
+@property (nonatomic, assign) uint64_t jobId;
+@property (nonatomic, assign) uint64_t totalInputBytes;
+@property (nonatomic, assign) uint64_t bytesRead;
+@property (nonatomic, assign) uint64_t bytesWritten;
+@property (nonatomic, assign) int inputLevel;
+@property (nonatomic, assign) int outputLevel;
+@property (nonatomic, assign) BOOL manualCompaction;
 @end
 
 @implementation RocksDBThreadStatus
 @synthesize threadId, threadType, databaseName, columnFamilyname, operationType, stateType;
+@synthesize operationElapsedMicros, operationStage, operationProperties;
+@synthesize jobId, totalInputBytes, bytesRead, bytesWritten, inputLevel, outputLevel, manualCompaction;
+
+- (instancetype)initWithThreadStatus:(const rocksdb::ThreadStatus &)status
+{
+	self = [super init];
+	if (self) {
+		self.threadId = status.thread_id;
+		self.threadType = (RocksDBThreadType)status.thread_type;
+		self.databaseName = [NSString stringWithCString:status.db_name.c_str() encoding:NSUTF8StringEncoding];
+		self.columnFamilyname = [NSString stringWithCString:status.cf_name.c_str() encoding:NSUTF8StringEncoding];
+		self.operationType = (RocksDBOperationType)status.operation_type;
+		self.stateType = (RocksDBStateType)status.state_type;
+		self.operationElapsedMicros = status.op_elapsed_micros;
+		self.operationStage = (RocksDBOperationStage)status.operation_stage;
+		self.inputLevel = -1;
+		self.outputLevel = -1;
+
+		const uint64_t *properties = status.op_properties;
+		switch (status.operation_type) {
+			case rocksdb::ThreadStatus::OP_COMPACTION:
+				self.jobId = properties[rocksdb::ThreadStatus::COMPACTION_JOB_ID];
+				self.totalInputBytes = properties[rocksdb::ThreadStatus::COMPACTION_TOTAL_INPUT_BYTES];
+				self.bytesRead = properties[rocksdb::ThreadStatus::COMPACTION_BYTES_READ];
+				self.bytesWritten = properties[rocksdb::ThreadStatus::COMPACTION_BYTES_WRITTEN];
+				// The base input level is packed into the upper and the output level into the lower 32 bits.
+				self.inputLevel = (int)(properties[rocksdb::ThreadStatus::COMPACTION_INPUT_OUTPUT_LEVEL] >> 32);
+				self.outputLevel = (int)(properties[rocksdb::ThreadStatus::COMPACTION_INPUT_OUTPUT_LEVEL] & 0xFFFFFFFF);
+				self.manualCompaction = (properties[rocksdb::ThreadStatus::COMPACTION_PROP_FLAGS] & 1) != 0;
+				break;
+			case rocksdb::ThreadStatus::OP_FLUSH:
+				self.jobId = properties[rocksdb::ThreadStatus::FLUSH_JOB_ID];
+				self.totalInputBytes = properties[rocksdb::ThreadStatus::FLUSH_BYTES_MEMTABLES];
+				self.bytesWritten = properties[rocksdb::ThreadStatus::FLUSH_BYTES_WRITTEN];
+				break;
+			default:
+				break;
+		}
+
+		NSMutableDictionary *interpreted = [NSMutableDictionary dictionary];
+		auto map = rocksdb::ThreadStatus::InterpretOperationProperties(status.operation_type, properties);
+		for (const auto &entry : map) {
+			interpreted[[NSString stringWithCString:entry.first.c_str() encoding:NSUTF8StringEncoding]] = @(entry.second);
+		}
+		self.operationProperties = interpreted;
+	}
+	return self;
+}
+
+- (double)progress
+{
+	if (self.operationType != RocksDBOperationCompaction || self.totalInputBytes == 0) {
+		return 0;
+	}
+	return MIN(1.0, (double)self.bytesRead / self.totalInputBytes);
+}
+
 @end
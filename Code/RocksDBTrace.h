@@ -0,0 +1,89 @@
+//
+//  RocksDBTrace.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDB;
+
+/** @brief The types of operations that can be excluded from a trace. */
+typedef NS_OPTIONS(uint64_t, RocksDBTraceFilter)
+{
+	RocksDBTraceFilterNone = 0,
+	RocksDBTraceFilterOutGets = 1 << 0,
+	RocksDBTraceFilterOutWrites = 1 << 1,
+	RocksDBTraceFilterOutIteratorSeeks = 1 << 2,
+	RocksDBTraceFilterOutIteratorSeeksForPrev = 1 << 3,
+	RocksDBTraceFilterOutMultiGets = 1 << 4
+};
+
+/**
+ Options to control the capture of a workload trace.
+
+ @see -[RocksDB startTraceWithOptions:toPath:error:]
+ */
+@interface RocksDBTraceOptions : NSObject
+
+/** @brief The trace stops once the trace file reaches this size.
+ The default is 64GB. */
+@property (nonatomic, assign) uint64_t maxTraceFileSize;
+
+/** @brief Trace only one in every samplingFrequency operations.
+ The default is 1 (trace all operations). */
+@property (nonatomic, assign) uint64_t samplingFrequency;
+
+/** @brief The types of operations that are not traced.
+ The default is RocksDBTraceFilterNone. */
+@property (nonatomic, assign) RocksDBTraceFilter filter;
+
+/** @brief If true, writes are traced in the order they are applied to the DB, rather than
+ the order they are issued in, at the cost of some write throughput.
+ The default is false. */
+@property (nonatomic, assign) BOOL preserveWriteOrder;
+
+@end
+
+/** @brief Replay the trace as fast as possible, ignoring the original timing. */
+extern const double RocksDBTraceReplaySpeedUnlimited;
+
+/**
+ Re-executes a workload trace captured with `-[RocksDB startTraceWithOptions:toPath:error:]`
+ against a database, e.g. a copy of the traced database with different options.
+
+ The Column Families of the target database must have the same IDs as those of the traced
+ database.
+ */
+@interface RocksDBTraceReplayer : NSObject
+
+/**
+ Initializes a new replayer for the given trace file.
+
+ @param path The path of the trace file.
+ @param database The database to replay the trace against.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return A newly-initialized replayer, nil if the trace file can't be read.
+ */
+- (nullable instancetype)initWithTraceAtPath:(NSString *)path
+									database:(RocksDB *)database
+									   error:(NSError * _Nullable *)error;
+
+/**
+ Replays the whole trace, blocking until it is done. A replayer can be used for only one replay.
+
+ @param threads The number of threads executing the traced operations.
+ @param speed The replay speed relative to the traced timing, e.g. 1 for the original speed,
+ or `RocksDBTraceReplaySpeedUnlimited`.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return True if the whole trace was replayed.
+ */
+- (BOOL)replayWithThreads:(uint32_t)threads speed:(double)speed error:(NSError * _Nullable *)error;
+
+/** @brief The number of operations replayed so far. */
+@property (nonatomic, readonly) uint64_t replayedOperations;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,171 @@
+//
+//  RocksDBTrace.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBTrace.h"
+#import "RocksDB+Private.h"
+#import "RocksDBColumnFamilyHandle+Private.h"
+#import "RocksDBError.h"
+
+#import <rocksdb/db.h>
+#import <rocksdb/trace_reader_writer.h>
+#import <rocksdb/trace_record_result.h>
+#import <rocksdb/utilities/replayer.h>
+
+#include <atomic>
+#include <limits>
+
+const double RocksDBTraceReplaySpeedUnlimited = 0;
+
+#pragma mark - Options
+
+@interface RocksDBTraceOptions ()
+{
+	rocksdb::TraceOptions _options;
+}
+@property (nonatomic, assign) rocksdb::TraceOptions options;
+@end
+
+@implementation RocksDBTraceOptions
+@synthesize options = _options;
+
+- (instancetype)init
+{
+	self = [super init];
+	if (self) {
+		_options = rocksdb::TraceOptions();
+	}
+	return self;
+}
+
+- (uint64_t)maxTraceFileSize
+{
+	return _options.max_trace_file_size;
+}
+
+- (void)setMaxTraceFileSize:(uint64_t)maxTraceFileSize
+{
+	_options.max_trace_file_size = maxTraceFileSize;
+}
+
+- (uint64_t)samplingFrequency
+{
+	return _options.sampling_frequency;
+}
+
+- (void)setSamplingFrequency:(uint64_t)samplingFrequency
+{
+	_options.sampling_frequency = samplingFrequency;
+}
+
+- (RocksDBTraceFilter)filter
+{
+	return (RocksDBTraceFilter)_options.filter;
+}
+
+- (void)setFilter:(RocksDBTraceFilter)filter
+{
+	_options.filter = filter;
+}
+
+- (BOOL)preserveWriteOrder
+{
+	return _options.preserve_write_order;
+}
+
+- (void)setPreserveWriteOrder:(BOOL)preserveWriteOrder
+{
+	_options.preserve_write_order = preserveWriteOrder;
+}
+
+@end
+
+#pragma mark - Replayer
+
+@interface RocksDBTraceReplayer ()
+{
+	RocksDB *_database;
+	std::unique_ptr<rocksdb::Replayer> _replayer;
+	std::atomic<uint64_t> _replayedOperations;
+}
+@end
+
+@implementation RocksDBTraceReplayer
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithTraceAtPath:(NSString *)path
+						   database:(RocksDB *)database
+							  error:(NSError * __autoreleasing *)error
+{
+	self = [super init];
+	if (self) {
+		_database = database;
+		_replayedOperations = 0;
+
+		rocksdb::DB *db = database.db;
+		std::unique_ptr<rocksdb::TraceReader> reader;
+		rocksdb::Status status = rocksdb::NewFileTraceReader(db->GetEnv(), rocksdb::EnvOptions(), path.UTF8String, &reader);
+
+		if (status.ok()) {
+			NSArray<RocksDBColumnFamilyHandle *> *columnFamilies = database.columnFamilies;
+			if (columnFamilies.count == 0) {
+				columnFamilies = @[database.columnFamily];
+			}
+
+			std::vector<rocksdb::ColumnFamilyHandle *> handles;
+			for (RocksDBColumnFamilyHandle *columnFamily in columnFamilies) {
+				handles.push_back(columnFamily.columnFamily);
+			}
+
+			status = db->NewDefaultReplayer(handles, std::move(reader), &_replayer);
+		}
+
+		if (status.ok()) {
+			status = _replayer->Prepare();
+		}
+
+		if (!status.ok()) {
+			NSError *temp = [RocksDBError errorWithRocksStatus:status];
+			if (error && *error == nil) {
+				*error = temp;
+			}
+			return nil;
+		}
+	}
+	return self;
+}
+
+#pragma mark - Replay
+
+- (BOOL)replayWithThreads:(uint32_t)threads speed:(double)speed error:(NSError * __autoreleasing *)error
+{
+	if (speed <= RocksDBTraceReplaySpeedUnlimited) {
+		// A practically infinite speed-up reduces all waits between operations to zero
+		speed = std::numeric_limits<double>::max();
+	}
+
+	rocksdb::ReplayOptions options(MAX(threads, 1u), speed);
+	std::atomic<uint64_t> *replayedOperations = &_replayedOperations;
+	rocksdb::Status status = _replayer->Replay(options, [replayedOperations](rocksdb::Status, std::unique_ptr<rocksdb::TraceRecordResult> &&) {
+		replayedOperations->fetch_add(1, std::memory_order_relaxed);
+	});
+
+	// Reaching the end of the trace is reported as incomplete
+	if (!status.ok() && !status.IsIncomplete()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return NO;
+	}
+	return YES;
+}
+
+- (uint64_t)replayedOperations
+{
+	return _replayedOperations.load(std::memory_order_relaxed);
+}
+
+@end
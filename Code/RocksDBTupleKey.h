@@ -0,0 +1,169 @@
+//
+//  RocksDBTupleKey.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The types of the fields of a tuple key. Fields of different types order by their type
+ in the order listed here.
+ */
+typedef NS_ENUM(NSUInteger, RocksDBTupleFieldType)
+{
+	/** @brief Not a valid field, e.g. at the end of the tuple. */
+	RocksDBTupleFieldInvalid = 0,
+	RocksDBTupleFieldNull,
+	RocksDBTupleFieldData,
+	RocksDBTupleFieldString,
+	RocksDBTupleFieldInt64,
+	RocksDBTupleFieldDouble
+};
+
+/**
+ Encodes composite keys as a tuple of typed fields, such that the bytewise order of the encoded
+ keys matches the field-by-field order of the tuples. Keys encoded this way sort correctly
+ with the default bytewise comparator, so no custom `RocksDBComparator` is needed.
+
+ Integers are stored big-endian with the sign bit flipped, doubles in IEEE 754 total order
+ (with -0.0 before 0.0), and strings and data are escaped and terminated so that a shorter
+ value sorts before any value it is a prefix of.
+
+ An encoder can be reused for multiple keys by calling `reset`, which keeps the allocated
+ buffer.
+
+ @see RocksDBTupleDecoder
+ @see RocksDBPrefixTupleFields
+ */
+@interface RocksDBTupleEncoder : NSObject
+
+/**
+ Initializes a new encoder with an empty buffer.
+ */
+- (instancetype)init;
+
+/**
+ Initializes a new encoder with a buffer preallocated for the given number of bytes.
+
+ @param capacity The number of bytes to preallocate.
+ */
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+/**
+ Encodes the given tuple into a key.
+
+ @param tuple The fields of the tuple: NSNull, NSData, NSString or NSNumber instances. Numbers
+ created from a float or a double are encoded as doubles, all other numbers as 64-bit integers.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The encoded key, nil if the tuple contains an unsupported value.
+ */
++ (nullable NSData *)encodeTuple:(NSArray *)tuple error:(NSError * _Nullable *)error;
+
+/** @brief Appends a null field. */
+- (void)encodeNull;
+
+/** @brief Appends a data field. */
+- (void)encodeData:(NSData *)data NS_SWIFT_NAME(encodeData(_:));
+
+/** @brief Appends a UTF-8 string field. */
+- (void)encodeString:(NSString *)string NS_SWIFT_NAME(encodeString(_:));
+
+/** @brief Appends a 64-bit signed integer field. */
+- (void)encodeInt64:(int64_t)value NS_SWIFT_NAME(encodeInt64(_:));
+
+/** @brief Appends a double field. */
+- (void)encodeDouble:(double)value NS_SWIFT_NAME(encodeDouble(_:));
+
+/** @brief Clears the encoded fields, keeping the allocated buffer. */
+- (void)reset;
+
+/** @brief The length in bytes of the encoded fields. */
+@property (nonatomic, readonly) NSUInteger length;
+
+/** @brief A copy of the encoded fields. */
+@property (nonatomic, readonly) NSData *data;
+
+/**
+ Copies the encoded fields into the given buffer.
+
+ @param buffer The buffer to copy the encoded fields into.
+ @param maxLength The size of the buffer.
+ @return The number of bytes copied, 0 if the buffer is too small for the encoded fields.
+ */
+- (NSUInteger)getBytes:(void *)buffer maxLength:(NSUInteger)maxLength;
+
+@end
+
+/**
+ Decodes the fields of keys encoded with `RocksDBTupleEncoder` one at a time.
+ */
+@interface RocksDBTupleDecoder : NSObject
+
+/**
+ Initializes a new decoder for the given key. The decoder doesn't copy the key.
+
+ @param data The encoded key.
+ */
+- (instancetype)initWithData:(NSData *)data;
+
+/**
+ Decodes all fields of the given key.
+
+ @param data The encoded key.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The fields of the tuple as NSNull, NSData, NSString and NSNumber instances, nil if
+ the key is malformed.
+ */
++ (nullable NSArray *)decodeTuple:(NSData *)data error:(NSError * _Nullable *)error;
+
+/** @brief True if all fields have been decoded. */
+@property (nonatomic, readonly) BOOL atEnd;
+
+/** @brief The type of the next field, `RocksDBTupleFieldInvalid` at the end or for a malformed key. */
+@property (nonatomic, readonly) RocksDBTupleFieldType nextFieldType;
+
+/**
+ Decodes the next field, which must be a null field.
+
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return True if a null field was decoded.
+ */
+- (BOOL)decodeNull:(NSError * _Nullable *)error;
+
+/**
+ Decodes the next field, which must be a data field.
+
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The decoded data, nil if the next field is not a data field.
+ */
+- (nullable NSData *)decodeData:(NSError * _Nullable *)error;
+
+/**
+ Decodes the next field, which must be a string field.
+
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The decoded string, nil if the next field is not a string field or is not valid UTF-8.
+ */
+- (nullable NSString *)decodeString:(NSError * _Nullable *)error;
+
+/**
+ Decodes the next field, which must be an integer field.
+
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The decoded integer, nil if the next field is not an integer field.
+ */
+- (nullable NSNumber *)decodeInt64:(NSError * _Nullable *)error;
+
+/**
+ Decodes the next field, which must be a double field.
+
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return The decoded double, nil if the next field is not a double field.
+ */
+- (nullable NSNumber *)decodeDouble:(NSError * _Nullable *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
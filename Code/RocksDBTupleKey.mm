@@ -0,0 +1,303 @@
+//
+//  RocksDBTupleKey.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBTupleKey.h"
+#import "RocksDBError.h"
+#import "RocksDBTupleKeyCoding.h"
+
+#import <rocksdb/status.h>
+
+#include <string>
+
+#pragma mark - Encoder
+
+@interface RocksDBTupleEncoder ()
+{
+	std::string _buffer;
+}
+@end
+
+@implementation RocksDBTupleEncoder
+
+#pragma mark - Lifecycle
+
+- (instancetype)init
+{
+	return [self initWithCapacity:0];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity
+{
+	self = [super init];
+	if (self) {
+		_buffer.reserve(capacity);
+	}
+	return self;
+}
+
++ (NSData *)encodeTuple:(NSArray *)tuple error:(NSError * __autoreleasing *)error
+{
+	RocksDBTupleEncoder *encoder = [RocksDBTupleEncoder new];
+	for (id field in tuple) {
+		if (field == [NSNull null]) {
+			[encoder encodeNull];
+		} else if ([field isKindOfClass:[NSData class]]) {
+			[encoder encodeData:field];
+		} else if ([field isKindOfClass:[NSString class]]) {
+			[encoder encodeString:field];
+		} else if ([field isKindOfClass:[NSNumber class]]) {
+			const char *type = [field objCType];
+			if (strcmp(type, @encode(double)) == 0 || strcmp(type, @encode(float)) == 0) {
+				[encoder encodeDouble:[field doubleValue]];
+			} else {
+				[encoder encodeInt64:[field longLongValue]];
+			}
+		} else {
+			NSError *temp = [RocksDBError errorWithRocksStatus:rocksdb::Status::InvalidArgument("Unsupported tuple field type",
+																								 NSStringFromClass([field class]).UTF8String)];
+			if (error && *error == nil) {
+				*error = temp;
+			}
+			return nil;
+		}
+	}
+	return encoder.data;
+}
+
+#pragma mark - Encoding
+
+- (void)encodeNull
+{
+	RocksDBTupleAppendNull(&_buffer);
+}
+
+- (void)encodeData:(NSData *)data
+{
+	RocksDBTupleAppendBytes(&_buffer, kRocksDBTupleTagData, (const char *)data.bytes, data.length);
+}
+
+- (void)encodeString:(NSString *)string
+{
+	NSUInteger length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+	RocksDBTupleAppendBytes(&_buffer, kRocksDBTupleTagString, string.UTF8String, length);
+}
+
+- (void)encodeInt64:(int64_t)value
+{
+	RocksDBTupleAppendInt64(&_buffer, value);
+}
+
+- (void)encodeDouble:(double)value
+{
+	RocksDBTupleAppendDouble(&_buffer, value);
+}
+
+- (void)reset
+{
+	_buffer.clear();
+}
+
+#pragma mark - Accessors
+
+- (NSUInteger)length
+{
+	return _buffer.size();
+}
+
+- (NSData *)data
+{
+	return [NSData dataWithBytes:_buffer.data() length:_buffer.size()];
+}
+
+- (NSUInteger)getBytes:(void *)buffer maxLength:(NSUInteger)maxLength
+{
+	if (_buffer.size() > maxLength) {
+		return 0;
+	}
+	memcpy(buffer, _buffer.data(), _buffer.size());
+	return _buffer.size();
+}
+
+@end
+
+#pragma mark - Decoder
+
+static BOOL RocksDBTupleFieldCorruption(const char *message, NSError * __autoreleasing *error)
+{
+	NSError *temp = [RocksDBError errorWithRocksStatus:rocksdb::Status::Corruption(message)];
+	if (error && *error == nil) {
+		*error = temp;
+	}
+	return NO;
+}
+
+@interface RocksDBTupleDecoder ()
+{
+	NSData *_data;
+	rocksdb::Slice _remaining;
+}
+@end
+
+@implementation RocksDBTupleDecoder
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithData:(NSData *)data
+{
+	self = [super init];
+	if (self) {
+		_data = data;
+		_remaining = rocksdb::Slice((const char *)_data.bytes, _data.length);
+	}
+	return self;
+}
+
++ (NSArray *)decodeTuple:(NSData *)data error:(NSError * __autoreleasing *)error
+{
+	RocksDBTupleDecoder *decoder = [[RocksDBTupleDecoder alloc] initWithData:data];
+	NSMutableArray *tuple = [NSMutableArray array];
+	while (!decoder.atEnd) {
+		id field = nil;
+		switch (decoder.nextFieldType) {
+			case RocksDBTupleFieldNull:
+				field = [decoder decodeNull:error] ? [NSNull null] : nil;
+				break;
+			case RocksDBTupleFieldData:
+				field = [decoder decodeData:error];
+				break;
+			case RocksDBTupleFieldString:
+				field = [decoder decodeString:error];
+				break;
+			case RocksDBTupleFieldInt64:
+				field = [decoder decodeInt64:error];
+				break;
+			case RocksDBTupleFieldDouble:
+				field = [decoder decodeDouble:error];
+				break;
+			case RocksDBTupleFieldInvalid:
+				[decoder nextField:RocksDBTupleFieldInvalid error:error];
+				break;
+		}
+		if (field == nil) {
+			return nil;
+		}
+		[tuple addObject:field];
+	}
+	return tuple;
+}
+
+#pragma mark - Decoding
+
+- (BOOL)atEnd
+{
+	return _remaining.empty();
+}
+
+- (RocksDBTupleFieldType)nextFieldType
+{
+	if (RocksDBTupleFieldLength(_remaining) == 0) {
+		return RocksDBTupleFieldInvalid;
+	}
+
+	switch ((unsigned char)_remaining[0]) {
+		case kRocksDBTupleTagNull:
+			return RocksDBTupleFieldNull;
+		case kRocksDBTupleTagData:
+			return RocksDBTupleFieldData;
+		case kRocksDBTupleTagString:
+			return RocksDBTupleFieldString;
+		case kRocksDBTupleTagInt64:
+			return RocksDBTupleFieldInt64;
+		case kRocksDBTupleTagDouble:
+			return RocksDBTupleFieldDouble;
+		default:
+			return RocksDBTupleFieldInvalid;
+	}
+}
+
+- (BOOL)nextField:(RocksDBTupleFieldType)type field:(rocksdb::Slice *)field error:(NSError * __autoreleasing *)error
+{
+	if (type == RocksDBTupleFieldInvalid || self.nextFieldType != type) {
+		return RocksDBTupleFieldCorruption(self.atEnd ? "No more tuple fields" : "Unexpected tuple field", error);
+	}
+
+	size_t length = RocksDBTupleFieldLength(_remaining);
+	*field = rocksdb::Slice(_remaining.data(), length);
+	_remaining.remove_prefix(length);
+	return YES;
+}
+
+- (BOOL)nextField:(RocksDBTupleFieldType)type error:(NSError * __autoreleasing *)error
+{
+	rocksdb::Slice field;
+	return [self nextField:type field:&field error:error];
+}
+
+- (BOOL)decodeNull:(NSError * __autoreleasing *)error
+{
+	return [self nextField:RocksDBTupleFieldNull error:error];
+}
+
+- (NSData *)decodeData:(NSError * __autoreleasing *)error
+{
+	rocksdb::Slice field;
+	std::string value;
+	if (![self nextField:RocksDBTupleFieldData field:&field error:error]) {
+		return nil;
+	}
+	if (!RocksDBTupleDecodeBytes(field, &value)) {
+		RocksDBTupleFieldCorruption("Malformed tuple field", error);
+		return nil;
+	}
+	return [NSData dataWithBytes:value.data() length:value.size()];
+}
+
+- (NSString *)decodeString:(NSError * __autoreleasing *)error
+{
+	rocksdb::Slice field;
+	std::string value;
+	if (![self nextField:RocksDBTupleFieldString field:&field error:error]) {
+		return nil;
+	}
+	if (!RocksDBTupleDecodeBytes(field, &value)) {
+		RocksDBTupleFieldCorruption("Malformed tuple field", error);
+		return nil;
+	}
+	NSString *string = [[NSString alloc] initWithBytes:value.data() length:value.size() encoding:NSUTF8StringEncoding];
+	if (string == nil) {
+		RocksDBTupleFieldCorruption("Tuple string field is not valid UTF-8", error);
+	}
+	return string;
+}
+
+- (NSNumber *)decodeInt64:(NSError * __autoreleasing *)error
+{
+	rocksdb::Slice field;
+	int64_t value;
+	if (![self nextField:RocksDBTupleFieldInt64 field:&field error:error]) {
+		return nil;
+	}
+	if (!RocksDBTupleDecodeInt64(field, &value)) {
+		RocksDBTupleFieldCorruption("Malformed tuple field", error);
+		return nil;
+	}
+	return @(value);
+}
+
+- (NSNumber *)decodeDouble:(NSError * __autoreleasing *)error
+{
+	rocksdb::Slice field;
+	double value;
+	if (![self nextField:RocksDBTupleFieldDouble field:&field error:error]) {
+		return nil;
+	}
+	if (!RocksDBTupleDecodeDouble(field, &value)) {
+		RocksDBTupleFieldCorruption("Malformed tuple field", error);
+		return nil;
+	}
+	return @(value);
+}
+
+@end
@@ -0,0 +1,193 @@
+//
+//  RocksDBTupleKeyCoding.cpp
+//  ObjectiveRocks
+//
+
+#import "RocksDBTupleKeyCoding.h"
+
+#include <cstring>
+
+static const uint64_t kSignBit = 1ull << 63;
+
+static void AppendBigEndian64(std::string* dst, uint64_t value)
+{
+	char buffer[8];
+	for (int i = 7; i >= 0; --i) {
+		buffer[i] = (char)(value & 0xFF);
+		value >>= 8;
+	}
+	dst->append(buffer, 8);
+}
+
+static uint64_t DecodeBigEndian64(const char* data)
+{
+	uint64_t value = 0;
+	for (int i = 0; i < 8; ++i) {
+		value = (value << 8) | (unsigned char)data[i];
+	}
+	return value;
+}
+
+void RocksDBTupleAppendNull(std::string* dst)
+{
+	dst->push_back((char)kRocksDBTupleTagNull);
+}
+
+void RocksDBTupleAppendBytes(std::string* dst, RocksDBTupleTag tag, const char* data, size_t size)
+{
+	dst->push_back((char)tag);
+	const char* end = data + size;
+	while (data < end) {
+		const char* zero = (const char*)memchr(data, 0, end - data);
+		if (zero == nullptr) {
+			dst->append(data, end - data);
+			break;
+		}
+		dst->append(data, zero - data + 1);
+		dst->push_back((char)0xFF);
+		data = zero + 1;
+	}
+	dst->push_back(0);
+}
+
+void RocksDBTupleAppendInt64(std::string* dst, int64_t value)
+{
+	dst->push_back((char)kRocksDBTupleTagInt64);
+	AppendBigEndian64(dst, (uint64_t)value ^ kSignBit);
+}
+
+void RocksDBTupleAppendDouble(std::string* dst, double value)
+{
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	// Negative numbers order in reverse, so flip all their bits; positive ones just need the sign bit set
+	bits = (bits & kSignBit) ? ~bits : bits ^ kSignBit;
+
+	dst->push_back((char)kRocksDBTupleTagDouble);
+	AppendBigEndian64(dst, bits);
+}
+
+size_t RocksDBTupleFieldLength(const rocksdb::Slice& src)
+{
+	if (src.empty()) {
+		return 0;
+	}
+
+	switch ((unsigned char)src[0]) {
+		case kRocksDBTupleTagNull:
+			return 1;
+		case kRocksDBTupleTagInt64:
+		case kRocksDBTupleTagDouble:
+			return src.size() >= 9 ? 9 : 0;
+		case kRocksDBTupleTagData:
+		case kRocksDBTupleTagString: {
+			const char* data = src.data();
+			size_t i = 1;
+			while (i < src.size()) {
+				const char* zero = (const char*)memchr(data + i, 0, src.size() - i);
+				if (zero == nullptr) {
+					return 0;
+				}
+				i = zero - data + 1;
+				if (i == src.size() || (unsigned char)data[i] != 0xFF) {
+					return i;
+				}
+				++i;
+			}
+			return 0;
+		}
+		default:
+			return 0;
+	}
+}
+
+bool RocksDBTupleDecodeInt64(const rocksdb::Slice& field, int64_t* value)
+{
+	if (field.size() != 9 || (unsigned char)field[0] != kRocksDBTupleTagInt64) {
+		return false;
+	}
+	*value = (int64_t)(DecodeBigEndian64(field.data() + 1) ^ kSignBit);
+	return true;
+}
+
+bool RocksDBTupleDecodeDouble(const rocksdb::Slice& field, double* value)
+{
+	if (field.size() != 9 || (unsigned char)field[0] != kRocksDBTupleTagDouble) {
+		return false;
+	}
+	uint64_t bits = DecodeBigEndian64(field.data() + 1);
+	bits = (bits & kSignBit) ? bits ^ kSignBit : ~bits;
+	memcpy(value, &bits, sizeof(bits));
+	return true;
+}
+
+bool RocksDBTupleDecodeBytes(const rocksdb::Slice& field, std::string* value)
+{
+	if (field.size() < 2 || field[field.size() - 1] != 0) {
+		return false;
+	}
+	unsigned char tag = (unsigned char)field[0];
+	if (tag != kRocksDBTupleTagData && tag != kRocksDBTupleTagString) {
+		return false;
+	}
+
+	value->clear();
+	value->reserve(field.size() - 2);
+	for (size_t i = 1; i < field.size() - 1; ++i) {
+		value->push_back(field[i]);
+		if (field[i] == 0) {
+			// Skip the escape byte
+			++i;
+		}
+	}
+	return true;
+}
+
+class RocksDBTuplePrefixSliceTransformImpl : public rocksdb::SliceTransform
+{
+private:
+	size_t fieldCount;
+	std::string name;
+
+	size_t PrefixLength(const rocksdb::Slice& src) const
+	{
+		size_t length = 0;
+		for (size_t i = 0; i < fieldCount; ++i) {
+			size_t fieldLength = RocksDBTupleFieldLength(rocksdb::Slice(src.data() + length, src.size() - length));
+			if (fieldLength == 0) {
+				return 0;
+			}
+			length += fieldLength;
+		}
+		return length;
+	}
+
+public:
+	RocksDBTuplePrefixSliceTransformImpl(size_t fieldCount):
+	fieldCount(fieldCount), name("ObjectiveRocks.TuplePrefix." + std::to_string(fieldCount)) {}
+
+	virtual const char* Name() const
+	{
+		return name.c_str();
+	}
+
+	virtual rocksdb::Slice Transform(const rocksdb::Slice& src) const
+	{
+		return rocksdb::Slice(src.data(), PrefixLength(src));
+	}
+
+	virtual bool InDomain(const rocksdb::Slice& src) const
+	{
+		return fieldCount > 0 && PrefixLength(src) > 0;
+	}
+
+	virtual bool InRange(const rocksdb::Slice& dst) const
+	{
+		return fieldCount > 0 && PrefixLength(dst) == dst.size();
+	}
+};
+
+const rocksdb::SliceTransform* RocksDBTuplePrefixSliceTransform(size_t fieldCount)
+{
+	return new RocksDBTuplePrefixSliceTransformImpl(fieldCount);
+}
@@ -0,0 +1,45 @@
+//
+//  RocksDBTupleKeyCoding.h
+//  ObjectiveRocks
+//
+
+#ifndef __ObjectiveRocks__RocksDBTupleKeyCoding__
+#define __ObjectiveRocks__RocksDBTupleKeyCoding__
+
+#include <string>
+
+#import <rocksdb/slice.h>
+#import <rocksdb/slice_transform.h>
+
+/*
+ Each tuple field starts with a one byte type tag, so values of different types order by
+ their tag. Integers and doubles are 8 bytes big-endian, transformed so that their bytewise
+ order matches their numeric order. Strings and data are escaped (0x00 -> 0x00 0xFF) and
+ terminated by a single 0x00, which sorts before any escaped byte and any following tag.
+ */
+enum RocksDBTupleTag : unsigned char
+{
+	kRocksDBTupleTagNull = 0x05,
+	kRocksDBTupleTagData = 0x10,
+	kRocksDBTupleTagString = 0x20,
+	kRocksDBTupleTagInt64 = 0x30,
+	kRocksDBTupleTagDouble = 0x40
+};
+
+extern void RocksDBTupleAppendNull(std::string* dst);
+extern void RocksDBTupleAppendBytes(std::string* dst, RocksDBTupleTag tag, const char* data, size_t size);
+extern void RocksDBTupleAppendInt64(std::string* dst, int64_t value);
+extern void RocksDBTupleAppendDouble(std::string* dst, double value);
+
+/// Returns the encoded length of the field at the start of src, or 0 if it is malformed.
+extern size_t RocksDBTupleFieldLength(const rocksdb::Slice& src);
+
+/// Each decode function expects a single complete field as returned by RocksDBTupleFieldLength.
+extern bool RocksDBTupleDecodeInt64(const rocksdb::Slice& field, int64_t* value);
+extern bool RocksDBTupleDecodeDouble(const rocksdb::Slice& field, double* value);
+extern bool RocksDBTupleDecodeBytes(const rocksdb::Slice& field, std::string* value);
+
+/// A prefix extractor that extracts the first fieldCount fields of each tuple key.
+extern const rocksdb::SliceTransform* RocksDBTuplePrefixSliceTransform(size_t fieldCount);
+
+#endif /* defined(__ObjectiveRocks__RocksDBTupleKeyCoding__) */
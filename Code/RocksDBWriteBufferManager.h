@@ -0,0 +1,66 @@
+//
+//  RocksDBWriteBufferManager.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+#import "RocksDBCache.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A Write Buffer Manager limits the total memory used by the memtables of all the
+ DB instances and Column Families it is shared with. When the memory usage exceeds
+ the limit, the memtables with the most data are flushed.
+
+ @discussion Share a single instance between the `RocksDBDatabaseOptions` of all the DBs
+ in the process to enforce one global memtable budget.
+ */
+@interface RocksDBWriteBufferManager : NSObject
+
+/**
+ Creates a Write Buffer Manager with the given memtable memory limit.
+
+ @param bufferSize The memtable memory limit in bytes. 0 disables the limit and
+ only tracks the memory usage.
+ */
++ (instancetype)writeBufferManagerWithBufferSize:(size_t)bufferSize;
+
+/**
+ Creates a Write Buffer Manager with the given memtable memory limit.
+
+ @param bufferSize The memtable memory limit in bytes. 0 disables the limit and
+ only tracks the memory usage.
+ @param cache If non-nil, the memtable memory is charged to this cache by inserting
+ dummy entries, so that the cache capacity bounds memtables and cached blocks together.
+ @param allowStall If `YES`, writes to all the DBs sharing this manager stall while
+ the memory usage exceeds the limit, until flushes bring it back under the limit.
+ */
++ (instancetype)writeBufferManagerWithBufferSize:(size_t)bufferSize
+										   cache:(nullable RocksDBCache *)cache
+									  allowStall:(BOOL)allowStall;
+
+/** @brief The memtable memory limit in bytes. Can be changed at runtime. */
+@property (nonatomic, assign) size_t bufferSize;
+
+/** @brief Whether writes stall while the memory usage exceeds the limit. Can be changed at runtime. */
+@property (nonatomic, assign) BOOL allowStall;
+
+/** @brief Whether a memory limit is enforced, i.e. `bufferSize` is not 0. */
+@property (nonatomic, readonly, getter=isEnabled) BOOL enabled;
+
+/** @brief Whether the memtable memory is charged to a cache. */
+@property (nonatomic, readonly) BOOL costToCache;
+
+/** @brief The cache the memtable memory is charged to, if any. */
+@property (nonatomic, strong, readonly, nullable) RocksDBCache *cache;
+
+/** @brief The total memory used by the memtables. */
+@property (nonatomic, readonly) size_t memoryUsage;
+
+/** @brief The memory used by the active memtables, i.e. the ones not yet scheduled for flush. */
+@property (nonatomic, readonly) size_t mutableMemtableMemoryUsage;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,110 @@
+//
+//  RocksDBWriteBufferManager.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBWriteBufferManager.h"
+
+#import <rocksdb/cache.h>
+#import <rocksdb/write_buffer_manager.h>
+
+@interface RocksDBCache ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::Cache> cache;
+@end
+
+@interface RocksDBWriteBufferManager ()
+{
+	RocksDBCache *_cache;
+	BOOL _allowStall;
+	std::shared_ptr<rocksdb::WriteBufferManager> _writeBufferManager;
+}
+@property (nonatomic, assign) std::shared_ptr<rocksdb::WriteBufferManager> writeBufferManager;
+@end
+
+@implementation RocksDBWriteBufferManager
+@synthesize cache = _cache;
+@synthesize writeBufferManager = _writeBufferManager;
+
+#pragma mark - Lifecycle
+
++ (instancetype)writeBufferManagerWithBufferSize:(size_t)bufferSize
+{
+	return [self writeBufferManagerWithBufferSize:bufferSize cache:nil allowStall:NO];
+}
+
++ (instancetype)writeBufferManagerWithBufferSize:(size_t)bufferSize
+										   cache:(RocksDBCache *)cache
+									  allowStall:(BOOL)allowStall
+{
+	std::shared_ptr<rocksdb::Cache> nativeCache = cache != nil ? cache.cache : nullptr;
+	return [[self alloc] initWithNativeWriteBufferManager:std::make_shared<rocksdb::WriteBufferManager>(bufferSize, nativeCache, allowStall)
+													cache:cache
+											   allowStall:allowStall];
+}
+
+- (instancetype)initWithNativeWriteBufferManager:(std::shared_ptr<rocksdb::WriteBufferManager>)writeBufferManager
+										   cache:(RocksDBCache *)cache
+									  allowStall:(BOOL)allowStall
+{
+	self = [super init];
+	if (self) {
+		_writeBufferManager = writeBufferManager;
+		_cache = cache;
+		_allowStall = allowStall;
+	}
+	return self;
+}
+
+- (void)dealloc
+{
+	@synchronized(self) {
+		if (_writeBufferManager != nullptr) {
+			_writeBufferManager.reset();
+		}
+	}
+}
+
+#pragma mark - Accessors
+
+- (void)setBufferSize:(size_t)bufferSize
+{
+	_writeBufferManager->SetBufferSize(bufferSize);
+}
+
+- (size_t)bufferSize
+{
+	return _writeBufferManager->buffer_size();
+}
+
+- (void)setAllowStall:(BOOL)allowStall
+{
+	_allowStall = allowStall;
+	_writeBufferManager->SetAllowStall(allowStall);
+}
+
+- (BOOL)allowStall
+{
+	return _allowStall;
+}
+
+- (BOOL)isEnabled
+{
+	return _writeBufferManager->enabled();
+}
+
+- (BOOL)costToCache
+{
+	return _writeBufferManager->cost_to_cache();
+}
+
+- (size_t)memoryUsage
+{
+	return _writeBufferManager->memory_usage();
+}
+
+- (size_t)mutableMemtableMemoryUsage
+{
+	return _writeBufferManager->mutable_memtable_memory_usage();
+}
+
+@end
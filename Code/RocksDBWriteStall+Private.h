@@ -0,0 +1,40 @@
+//
+//  RocksDBWriteStall+Private.h
+//  ObjectiveRocks
+//
+
+#import "RocksDBWriteStall.h"
+
+#include <vector>
+
+namespace rocksdb {
+	class DB;
+	class ColumnFamilyHandle;
+}
+
+/**
+ This category is intended to hide all C++ types from the public interface in order to
+ maintain a pure Objective-C API for Swift compatibility.
+ */
+@interface RocksDBWriteStallState (Private)
+
+/**
+ Initializes a new instance of `RocksDBWriteStallState` by reading the properties of the
+ given DB and column families.
+ */
+- (instancetype)initWithDB:(rocksdb::DB *)db
+			columnFamilies:(const std::vector<rocksdb::ColumnFamilyHandle *> &)columnFamilies;
+
+@end
+
+@interface RocksDBWriteAdmissionControl (Private)
+
+/**
+ Decides whether a low priority write may proceed, waiting in `RocksDBWriteAdmissionModeDefer`.
+
+ @param stateBlock A block that reads the current write stall state.
+ @return YES if the write may proceed, NO if it should be rejected.
+ */
+- (BOOL)admitLowPriorityWriteWithState:(RocksDBWriteStallState * (^)(void))stateBlock;
+
+@end
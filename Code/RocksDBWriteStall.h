@@ -0,0 +1,119 @@
+//
+//  RocksDBWriteStall.h
+//  ObjectiveRocks
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** @brief The state of the write controller of a DB. */
+typedef NS_ENUM(NSUInteger, RocksDBWriteStallCondition)
+{
+	/** @brief Writes proceed at full speed. */
+	RocksDBWriteStallConditionNormal,
+
+	/** @brief Writes are throttled to the delayed write rate. */
+	RocksDBWriteStallConditionDelayed,
+
+	/** @brief Writes are blocked until compactions or flushes catch up. */
+	RocksDBWriteStallConditionStopped
+};
+
+/** @brief The reasons that slow down or would soon slow down writes. */
+typedef NS_OPTIONS(NSUInteger, RocksDBWriteStallCause)
+{
+	/** @brief No column family is near a stall trigger. */
+	RocksDBWriteStallCauseNone = 0,
+
+	/** @brief Too many unflushed memtables. */
+	RocksDBWriteStallCauseMemTableLimit = 1 << 0,
+
+	/** @brief Too many files in level 0. */
+	RocksDBWriteStallCauseL0FileCount = 1 << 1,
+
+	/** @brief Too many bytes pending compaction. */
+	RocksDBWriteStallCausePendingCompactionBytes = 1 << 2
+};
+
+/**
+ A snapshot of the write stall state of a DB, read from `rocksdb.is-write-stopped`,
+ `rocksdb.actual-delayed-write-rate` and the per column family stall triggers.
+ */
+@interface RocksDBWriteStallState : NSObject
+
+/** @brief The current condition of the write controller. */
+@property (nonatomic, assign, readonly) RocksDBWriteStallCondition condition;
+
+/** @brief The column family metrics that reached their slowdown triggers. */
+@property (nonatomic, assign, readonly) RocksDBWriteStallCause causes;
+
+/** @brief The rate in bytes per second writes are throttled to, or 0 if writes are not delayed. */
+@property (nonatomic, assign, readonly) uint64_t delayedWriteRate;
+
+/** @brief The largest number of level 0 files of any column family. */
+@property (nonatomic, assign, readonly) uint64_t level0FileCount;
+
+/** @brief The largest estimated number of bytes pending compaction of any column family. */
+@property (nonatomic, assign, readonly) uint64_t pendingCompactionBytes;
+
+/** @brief The largest number of immutable memtables of any column family. */
+@property (nonatomic, assign, readonly) uint64_t immutableMemTableCount;
+
+/**
+ @brief How close the DB is to a write slowdown: the largest ratio of a column family metric to its
+ slowdown trigger. Writes are delayed once this reaches 1.
+ */
+@property (nonatomic, assign, readonly) double pressure;
+
+@end
+
+/** @brief What `RocksDBWriteAdmissionControl` does with a low priority write under pressure. */
+typedef NS_ENUM(NSUInteger, RocksDBWriteAdmissionMode)
+{
+	/** @brief Fail the write immediately. */
+	RocksDBWriteAdmissionModeShed,
+
+	/** @brief Wait up to `maxDeferral` for the pressure to drop, then fail the write. */
+	RocksDBWriteAdmissionModeDefer
+};
+
+/**
+ Holds back writes with `lowPriority` set in their `RocksDBWriteOptions` before the engine stalls,
+ so that they don't queue up behind a delayed or stopped write controller.
+
+ @discussion Rejected writes fail with a `RocksDBErrorDomain` error whose code is the RocksDB
+ `Incomplete` status code, the same as the engine uses for `noSlowdown` writes. Writes without
+ `lowPriority` are never held back.
+
+ @warning Not available in RocksDB Lite.
+ */
+@interface RocksDBWriteAdmissionControl : NSObject
+
+/** @brief What to do with low priority writes under pressure. The default is `RocksDBWriteAdmissionModeShed`. */
+@property (nonatomic, assign) RocksDBWriteAdmissionMode mode;
+
+/**
+ @brief The `pressure` of the write stall state at and above which low priority writes are held back.
+ Writes are always held back while the DB is delayed or stopped. The default is 0.8.
+ */
+@property (nonatomic, assign) double pressureThreshold;
+
+/** @brief The maximum time in seconds a low priority write is deferred. The default is 1. */
+@property (nonatomic, assign) NSTimeInterval maxDeferral;
+
+/**
+ @brief How long in seconds a write stall state is reused before it is read again, which keeps the
+ per-write overhead low. The default is 0.05.
+ */
+@property (nonatomic, assign) NSTimeInterval refreshInterval;
+
+/** @brief The number of low priority writes that were rejected. */
+@property (nonatomic, assign, readonly) uint64_t shedWriteCount;
+
+/** @brief The number of low priority writes that were deferred and then admitted. */
+@property (nonatomic, assign, readonly) uint64_t deferredWriteCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,196 @@
+//
+//  RocksDBWriteStall.mm
+//  ObjectiveRocks
+//
+
+#import "RocksDBWriteStall.h"
+#import "RocksDBWriteStall+Private.h"
+
+#import <rocksdb/db.h>
+#import <rocksdb/options.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+#pragma mark - Write Stall State
+
+@interface RocksDBWriteStallState ()
+@property (nonatomic, assign) RocksDBWriteStallCondition condition;
+@property (nonatomic, assign) RocksDBWriteStallCause causes;
+@property (nonatomic, assign) uint64_t delayedWriteRate;
+@property (nonatomic, assign) uint64_t level0FileCount;
+@property (nonatomic, assign) uint64_t pendingCompactionBytes;
+@property (nonatomic, assign) uint64_t immutableMemTableCount;
+@property (nonatomic, assign) double pressure;
+@end
+
+@implementation RocksDBWriteStallState
+@synthesize condition, causes, delayedWriteRate, level0FileCount, pendingCompactionBytes, immutableMemTableCount, pressure;
+
+static uint64_t IntProperty(rocksdb::DB *db, rocksdb::ColumnFamilyHandle *columnFamily, const std::string &property)
+{
+	uint64_t value = 0;
+	db->GetIntProperty(columnFamily, property, &value);
+	return value;
+}
+
+- (instancetype)initWithDB:(rocksdb::DB *)db
+			columnFamilies:(const std::vector<rocksdb::ColumnFamilyHandle *> &)columnFamilies
+{
+	self = [super init];
+	if (self) {
+		rocksdb::ColumnFamilyHandle *defaultColumnFamily = db->DefaultColumnFamily();
+		uint64_t stopped = IntProperty(db, defaultColumnFamily, rocksdb::DB::Properties::kIsWriteStopped);
+		self.delayedWriteRate = IntProperty(db, defaultColumnFamily, rocksdb::DB::Properties::kActualDelayedWriteRate);
+		if (stopped != 0) {
+			self.condition = RocksDBWriteStallConditionStopped;
+		} else if (self.delayedWriteRate != 0) {
+			self.condition = RocksDBWriteStallConditionDelayed;
+		} else {
+			self.condition = RocksDBWriteStallConditionNormal;
+		}
+
+		RocksDBWriteStallCause stallCauses = RocksDBWriteStallCauseNone;
+		double maxPressure = 0;
+
+		for (rocksdb::ColumnFamilyHandle *columnFamily : columnFamilies) {
+			rocksdb::Options options = db->GetOptions(columnFamily);
+
+			// num-files-at-level<N> is only available as a string property.
+			std::string level0;
+			db->GetProperty(columnFamily, rocksdb::DB::Properties::kNumFilesAtLevelPrefix + "0", &level0);
+			uint64_t level0Files = std::strtoull(level0.c_str(), nullptr, 10);
+			uint64_t pendingBytes = IntProperty(db, columnFamily, rocksdb::DB::Properties::kEstimatePendingCompactionBytes);
+			uint64_t immutableMemTables = IntProperty(db, columnFamily, rocksdb::DB::Properties::kNumImmutableMemTable);
+
+			self.level0FileCount = std::max(self.level0FileCount, level0Files);
+			self.pendingCompactionBytes = std::max(self.pendingCompactionBytes, pendingBytes);
+			self.immutableMemTableCount = std::max(self.immutableMemTableCount, immutableMemTables);
+
+			if (options.level0_slowdown_writes_trigger > 0) {
+				double ratio = (double)level0Files / options.level0_slowdown_writes_trigger;
+				maxPressure = std::max(maxPressure, ratio);
+				if (ratio >= 1) stallCauses |= RocksDBWriteStallCauseL0FileCount;
+			}
+
+			if (options.soft_pending_compaction_bytes_limit > 0) {
+				double ratio = (double)pendingBytes / options.soft_pending_compaction_bytes_limit;
+				maxPressure = std::max(maxPressure, ratio);
+				if (ratio >= 1) stallCauses |= RocksDBWriteStallCausePendingCompactionBytes;
+			}
+
+			// RocksDB delays writes once the immutable memtables reach max_write_buffer_number - 1,
+			// but only if more than 3 memtables are allowed, and stops them at max_write_buffer_number.
+			int memTableTrigger = options.max_write_buffer_number > 3 ? options.max_write_buffer_number - 1 : options.max_write_buffer_number;
+			if (memTableTrigger > 0) {
+				double ratio = (double)immutableMemTables / memTableTrigger;
+				maxPressure = std::max(maxPressure, ratio);
+				if (ratio >= 1) stallCauses |= RocksDBWriteStallCauseMemTableLimit;
+			}
+		}
+
+		self.causes = stallCauses;
+		self.pressure = maxPressure;
+	}
+	return self;
+}
+
+- (NSString *)description
+{
+	NSArray *conditions = @[@"normal", @"delayed", @"stopped"];
+	return [NSString stringWithFormat:@"<WriteStallState Condition: %@, Causes: %lu, Delayed Write Rate: %llu, L0 Files: %llu, Pending Compaction Bytes: %llu, Immutable MemTables: %llu, Pressure: %f>",
+			conditions[self.condition],
+			(unsigned long)self.causes,
+			self.delayedWriteRate,
+			self.level0FileCount,
+			self.pendingCompactionBytes,
+			self.immutableMemTableCount,
+			self.pressure];
+}
+
+@end
+
+#pragma mark - Write Admission Control
+
+@interface RocksDBWriteAdmissionControl ()
+{
+	RocksDBWriteStallState *_cachedState;
+	NSTimeInterval _cachedAt;
+	uint64_t _shedWriteCount;
+	uint64_t _deferredWriteCount;
+}
+@end
+
+@implementation RocksDBWriteAdmissionControl
+@synthesize mode, pressureThreshold, maxDeferral, refreshInterval;
+
+- (instancetype)init
+{
+	self = [super init];
+	if (self) {
+		self.mode = RocksDBWriteAdmissionModeShed;
+		self.pressureThreshold = 0.8;
+		self.maxDeferral = 1;
+		self.refreshInterval = 0.05;
+	}
+	return self;
+}
+
+- (uint64_t)shedWriteCount
+{
+	@synchronized(self) {
+		return _shedWriteCount;
+	}
+}
+
+- (uint64_t)deferredWriteCount
+{
+	@synchronized(self) {
+		return _deferredWriteCount;
+	}
+}
+
+- (RocksDBWriteStallState *)stateWithBlock:(RocksDBWriteStallState * (^)(void))stateBlock
+{
+	@synchronized(self) {
+		NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+		if (_cachedState == nil || now - _cachedAt >= self.refreshInterval) {
+			_cachedState = stateBlock();
+			_cachedAt = now;
+		}
+		return _cachedState;
+	}
+}
+
+- (BOOL)isUnderPressure:(RocksDBWriteStallState *)state
+{
+	return state.condition != RocksDBWriteStallConditionNormal || state.pressure >= self.pressureThreshold;
+}
+
+- (BOOL)admitLowPriorityWriteWithState:(RocksDBWriteStallState * (^)(void))stateBlock
+{
+	if (![self isUnderPressure:[self stateWithBlock:stateBlock]]) {
+		return YES;
+	}
+
+	if (self.mode == RocksDBWriteAdmissionModeDefer) {
+		NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:self.maxDeferral];
+		NSTimeInterval remaining;
+		while ((remaining = [deadline timeIntervalSinceNow]) > 0) {
+			[NSThread sleepForTimeInterval:MIN(MAX(self.refreshInterval, 0.001), remaining)];
+			if (![self isUnderPressure:[self stateWithBlock:stateBlock]]) {
+				@synchronized(self) {
+					_deferredWriteCount++;
+				}
+				return YES;
+			}
+		}
+	}
+
+	@synchronized(self) {
+		_shedWriteCount++;
+	}
+	return NO;
+}
+
+@end
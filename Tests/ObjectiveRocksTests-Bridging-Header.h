@@ -9,6 +9,7 @@
 
 #import <ObjectiveRocks/RocksDBIterator.h>
 #import <ObjectiveRocks/RocksDBPrefixExtractor.h>
+#import <ObjectiveRocks/RocksDBTupleKey.h>
 
 #import <ObjectiveRocks/RocksDBWriteBatch.h>
 
@@ -17,6 +18,7 @@
 #import <ObjectiveRocks/RocksDBOptions.h>
 #import <ObjectiveRocks/RocksDBDatabaseOptions.h>
 #import <ObjectiveRocks/RocksDBColumnFamilyOptions.h>
+#import <ObjectiveRocks/RocksDBCompressionOptions.h>
 #import <ObjectiveRocks/RocksDBWriteOptions.h>
 #import <ObjectiveRocks/RocksDBReadOptions.h>
 #import <ObjectiveRocks/RocksDBTableFactory.h>
@@ -24,6 +26,7 @@
 #import <ObjectiveRocks/RocksDBCache.h>
 #import <ObjectiveRocks/RocksDBFilterPolicy.h>
 #import <ObjectiveRocks/RocksDBMemTableRepFactory.h>
+#import <ObjectiveRocks/RocksDBWriteBufferManager.h>
 #import <ObjectiveRocks/RocksDBEnv.h>
 
 #import <ObjectiveRocks/RocksDBSnapshot.h>
@@ -35,6 +38,9 @@
 
 #import <ObjectiveRocks/RocksDBPlainTableOptions.h>
 #import <ObjectiveRocks/RocksDBCuckooTableOptions.h>
+#import <ObjectiveRocks/RocksDBTableProperties.h>
+#import <ObjectiveRocks/RocksDBTablePropertiesCollectorFactory.h>
+#import <ObjectiveRocks/RocksDBCachePrewarmer.h>
 
 #import <ObjectiveRocks/RocksDBThreadStatus.h>
 
@@ -42,6 +48,20 @@
 
 #import <ObjectiveRocks/RocksDBStatistics.h>
 #import <ObjectiveRocks/RocksDBStatisticsHistogram.h>
+#import <ObjectiveRocks/RocksDBStatisticsSnapshot.h>
+#import <ObjectiveRocks/RocksDBStatsHistory.h>
+#import <ObjectiveRocks/RocksDBMemoryUsage.h>
+#import <ObjectiveRocks/RocksDBMetricsExporter.h>
+#import <ObjectiveRocks/RocksDBPerfContext.h>
 
 #import <ObjectiveRocks/RocksDBBackupEngine.h>
 #import <ObjectiveRocks/RocksDBBackupInfo.h>
+
+#import <ObjectiveRocks/RocksDBTrace.h>
+#import <ObjectiveRocks/RocksDBBlockCacheTrace.h>
+#import <ObjectiveRocks/RocksDBInvocationStatistics.h>
+#import <ObjectiveRocks/RocksDBOperationMonitor.h>
+#import <ObjectiveRocks/RocksDBWriteStall.h>
+#import <ObjectiveRocks/RocksDBProperties.h>
+#import <ObjectiveRocks/RocksDBSizeApproximationOptions.h>
+#import <ObjectiveRocks/RocksDBMemTableStats.h>
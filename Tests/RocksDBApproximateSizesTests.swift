@@ -0,0 +1,141 @@
+//
+//  RocksDBApproximateSizesTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBApproximateSizesTests : RocksDBTests {
+
+	func testSwift_ApproximateSizes_MemTableStats() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let value = Data(count: 1000)
+		for i in 100..<200 {
+			try! rocks.setData(value, forKey: String(i).data)
+		}
+
+		let ranges = [
+			RocksDBMakeKeyRange("100".data, "200".data),
+			RocksDBMakeKeyRange("300".data, "400".data),
+			RocksDBMakeKeyRange("150".data, nil)
+		]
+
+		let stats = try! rocks.approximateMemTableStats(forRanges: ranges)
+
+		XCTAssertEqual(stats.count, 3)
+		XCTAssertGreaterThan(stats[0].count, 0 as UInt64)
+		XCTAssertGreaterThan(stats[0].size, 0 as UInt64)
+		XCTAssertEqual(stats[1].count, 0 as UInt64)
+		XCTAssertGreaterThan(stats[2].count, 0 as UInt64)
+
+		let sizeOptions = RocksDBSizeApproximationOptions()
+		sizeOptions.includeMemTables = true
+		sizeOptions.includeFiles = false
+
+		let sizes = try! rocks.approximateSizes(forRanges: ranges, with: sizeOptions)
+
+		XCTAssertEqual(sizes.count, 3)
+		XCTAssertGreaterThan(sizes[0].uint64Value, 0 as UInt64)
+		XCTAssertEqual(sizes[1].uint64Value, 0 as UInt64)
+	}
+
+	func testSwift_ApproximateSizes_Files() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let value = Data(count: 1000)
+		for i in 100..<200 {
+			try! rocks.setData(value, forKey: String(i).data)
+		}
+		try! rocks.compactRange(RocksDBOpenRange, with: RocksDBCompactRangeOptions())
+
+		let ranges = [
+			RocksDBMakeKeyRange("100".data, "200".data),
+			RocksDBMakeKeyRange("300".data, "400".data),
+			RocksDBMakeKeyRange("300".data, nil)
+		]
+
+		let sizeOptions = RocksDBSizeApproximationOptions()
+		sizeOptions.filesSizeErrorMargin = 0.1
+
+		let sizes = try! rocks.approximateSizes(forRanges: ranges, with: sizeOptions)
+
+		XCTAssertEqual(sizes.count, 3)
+		XCTAssertGreaterThan(sizes[0].uint64Value, 0 as UInt64)
+		XCTAssertEqual(sizes[1].uint64Value, 0 as UInt64)
+		XCTAssertEqual(sizes[2].uint64Value, 0 as UInt64)
+
+		XCTAssertEqual(try! rocks.approximateMemTableStats(forRanges: ranges)[0].count, 0 as UInt64)
+	}
+
+	func testSwift_ApproximateSizes_ColumnFamily() {
+		let descriptor = RocksDBColumnFamilyDescriptor()
+		descriptor.addDefaultColumnFamily(with: RocksDBColumnFamilyOptions())
+		descriptor.addColumnFamily(withName: "new_cf", andOptions: RocksDBColumnFamilyOptions())
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.createMissingColumnFamilies = true
+
+		rocks = try! RocksDB.database(atPath: path, columnFamilies: descriptor, andOptions: options)
+
+		let columnFamilies = rocks.columnFamilies()
+
+		let value = Data(count: 1000)
+		for i in 100..<200 {
+			try! rocks.setData(value, forKey: String(i).data, forColumnFamily: columnFamilies[1])
+		}
+
+		let ranges = [RocksDBMakeKeyRange(nil, nil)]
+
+		let sizeOptions = RocksDBSizeApproximationOptions()
+		sizeOptions.includeMemTables = true
+
+		XCTAssertEqual(try! rocks.approximateSizes(forRanges: ranges, with: sizeOptions, inColumnFamily: columnFamilies[0])[0].uint64Value, 0 as UInt64)
+		XCTAssertGreaterThan(try! rocks.approximateSizes(forRanges: ranges, with: sizeOptions, inColumnFamily: columnFamilies[1])[0].uint64Value, 0 as UInt64)
+
+		XCTAssertEqual(try! rocks.approximateMemTableStats(forRanges: ranges, inColumnFamily: columnFamilies[0])[0].count, 0 as UInt64)
+		XCTAssertGreaterThan(try! rocks.approximateMemTableStats(forRanges: ranges, inColumnFamily: columnFamilies[1])[0].count, 0 as UInt64)
+	}
+
+	func testSwift_ApproximateSizes_InvalidOptions() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let sizeOptions = RocksDBSizeApproximationOptions()
+		sizeOptions.includeMemTables = false
+		sizeOptions.includeFiles = false
+
+		XCTAssertNil(try? rocks.approximateSizes(forRanges: [RocksDBOpenRange], with: sizeOptions))
+	}
+
+	func testSwift_ApproximateSizes_OpenRange_NonBytewiseComparator() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.comparator = RocksDBComparator(type: .bytewiseDescending)
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 100..<200 {
+			try! rocks.setData("value".data, forKey: String(i).data)
+		}
+
+		let sizeOptions = RocksDBSizeApproximationOptions()
+		sizeOptions.includeMemTables = true
+
+		XCTAssertNil(try? rocks.approximateSizes(forRanges: [RocksDBMakeKeyRange("150".data, nil)], with: sizeOptions))
+		XCTAssertNil(try? rocks.approximateMemTableStats(forRanges: [RocksDBMakeKeyRange(nil, "150".data)]))
+
+		let sizes = try! rocks.approximateSizes(forRanges: [RocksDBMakeKeyRange("199".data, "100".data)], with: sizeOptions)
+		XCTAssertGreaterThan(sizes[0].uint64Value, 0 as UInt64)
+	}
+}
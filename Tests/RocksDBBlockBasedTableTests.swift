@@ -0,0 +1,36 @@
+//
+//  RocksDBBlockBasedTableTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBBlockBasedTableTests : RocksDBTests {
+
+	func testSwift_BlockBasedTable_DataBlockHashIndex() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+			XCTAssertEqual(options.dataBlockIndexType, .binarySearch)
+			XCTAssertEqual(options.dataBlockHashTableUtilRatio, 0.75)
+
+			options.dataBlockIndexType = .binaryAndHash
+			options.dataBlockHashTableUtilRatio = 0.5
+
+			XCTAssertEqual(options.dataBlockIndexType, .binaryAndHash)
+			XCTAssertEqual(options.dataBlockHashTableUtilRatio, 0.5)
+		})
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<1000 {
+			try! rocks.setData("value \(i)".data, forKey: "key \(i)".data)
+		}
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		for i in 0..<1000 {
+			XCTAssertEqual(try! rocks.data(forKey: "key \(i)".data), "value \(i)".data)
+		}
+	}
+}
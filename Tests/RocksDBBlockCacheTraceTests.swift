@@ -0,0 +1,64 @@
+//
+//  RocksDBBlockCacheTraceTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBBlockCacheTraceTests : RocksDBTests {
+
+	func testSwift_BlockCacheTrace_MissRatioCurve() {
+		let tracePath = self.path + ".blockcachetrace"
+		defer { try? FileManager.default.removeItem(atPath: tracePath) }
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+			options.blockCache = RocksDBCache.lruCache(withCapacity: 1024 * 1024)
+			options.blockSize = 1024
+		})
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<1000 {
+			try! rocks.setData("value \(i)".data, forKey: "key \(i)".data)
+		}
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		try! rocks.startBlockCacheTrace(with: RocksDBTraceOptions(), toPath: tracePath)
+		for _ in 0..<3 {
+			for i in 0..<1000 {
+				_ = try? rocks.data(forKey: "key \(i)".data)
+			}
+		}
+		try! rocks.endBlockCacheTrace()
+
+		XCTAssertTrue(FileManager.default.fileExists(atPath: tracePath))
+
+		let capacities: [NSNumber] = [1024, 64 * 1024, 1024 * 1024]
+		let simulation = RocksDBCacheSimulation(capacities: capacities,
+												policies: [NSNumber(value: RocksDBCacheSimulationPolicy.LRU.rawValue)])
+		XCTAssertEqual(simulation.downsampleRatio, 1)
+
+		let curve = try! simulation.simulateTrace(atPath: tracePath)
+		XCTAssertEqual(curve.count, 3)
+		XCTAssertEqual(curve.map { $0.capacity }, [1024, 64 * 1024, 1024 * 1024])
+
+		for point in curve {
+			XCTAssertEqual(point.policy, .LRU)
+			XCTAssertGreaterThan(point.accesses, 0)
+			XCTAssertLessThanOrEqual(point.misses, point.accesses)
+		}
+
+		// A larger cache never misses more often
+		XCTAssertGreaterThanOrEqual(curve[0].missRatio, curve[2].missRatio)
+		XCTAssertLessThan(curve[2].missRatio, 1)
+	}
+
+	func testSwift_BlockCacheTrace_MissingTrace() {
+		let simulation = RocksDBCacheSimulation(capacities: [1024],
+												policies: [NSNumber(value: RocksDBCacheSimulationPolicy.LRU.rawValue)])
+		XCTAssertThrowsError(try simulation.simulateTrace(atPath: self.path + ".missing"))
+	}
+}
@@ -0,0 +1,148 @@
+//
+//  RocksDBCachePrewarmerTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBCachePrewarmerTests : RocksDBTests {
+
+	func testSwift_Prewarm_Profile() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<100 {
+			try! rocks.setData("value \(i)".data, forKey: String(format: "key %03d", i).data)
+		}
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		// RocksDB samples about one in 1024 file reads
+		for i in 0..<50000 {
+			_ = try? rocks.data(forKey: String(format: "key %03d", i % 100).data)
+		}
+
+		let profile = RocksDBPrewarmProfile(database: rocks, maxRanges: 10)
+		XCTAssertEqual(profile.ranges.count, 1)
+		XCTAssertEqual(profile.ranges[0].columnFamilyName, "default")
+		XCTAssertEqual(profile.ranges[0].start, "key 000".data)
+		XCTAssertEqual(profile.ranges[0].end, "key 099".data)
+		XCTAssertGreaterThan(profile.ranges[0].readsSampled, 0)
+
+		let profilePath = self.path + ".prewarm"
+		defer { try? FileManager.default.removeItem(atPath: profilePath) }
+
+		try! profile.write(toFile: profilePath)
+		let loaded = try! RocksDBPrewarmProfile(contentsOfFile: profilePath)
+		XCTAssertEqual(loaded.ranges.count, 1)
+		XCTAssertEqual(loaded.ranges[0].end, "key 099".data)
+		XCTAssertEqual(loaded.ranges[0].readsSampled, profile.ranges[0].readsSampled)
+	}
+
+	func testSwift_Prewarm_Replay() {
+		let cache = RocksDBCache.lruCache(withCapacity: 8 << 20)
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+			options.blockCache = cache
+		})
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<1000 {
+			try! rocks.setData("value \(i)".data, forKey: String(format: "key %04d", i).data)
+		}
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		let usageBefore = cache.usage
+
+		let profilePath = self.path + ".prewarm"
+		defer { try? FileManager.default.removeItem(atPath: profilePath) }
+		let plist: [String: Any] = [
+			"version": 1,
+			"ranges": [["cf": "default", "start": "key 0000".data, "end": "key 0999".data, "reads": 1, "size": 0]]
+		]
+		try! PropertyListSerialization.data(fromPropertyList: plist, format: .binary, options: 0).write(to: URL(fileURLWithPath: profilePath))
+
+		let profile = try! RocksDBPrewarmProfile(contentsOfFile: profilePath)
+		let prewarmer = RocksDBCachePrewarmer(database: rocks, profile: profile)
+		prewarmer.bytesPerSecond = 100 << 20
+
+		var progress: [UInt] = []
+		prewarmer.progressBlock = { (completed, total, bytes) in
+			progress.append(completed)
+			XCTAssertEqual(total, 1)
+			XCTAssertGreaterThan(bytes, 0)
+		}
+
+		let finished = expectation(description: "prewarm finished")
+		prewarmer.start { (error) in
+			XCTAssertNil(error)
+			finished.fulfill()
+		}
+		waitForExpectations(timeout: 10, handler: nil)
+		prewarmer.waitUntilFinished()
+
+		XCTAssertEqual(progress, [1])
+		XCTAssertFalse(prewarmer.isRunning)
+		XCTAssertGreaterThan(cache.usage, usageBefore)
+	}
+
+	func testSwift_Prewarm_Replay_Filters() {
+		let statistics = RocksDBStatistics()
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.statistics = statistics
+		options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+			options.blockCache = RocksDBCache.lruCache(withCapacity: 8 << 20)
+			options.cacheIndexAndFilterBlocks = true
+			options.filterPolicy = RocksDBFilterPolicy.bloomFilterPolicy(withBitsPerKey: 10)
+		})
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<1000 {
+			try! rocks.setData("value \(i)".data, forKey: String(format: "key %04d", i).data)
+		}
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		let filterAccesses = { statistics.count(for: .blockCacheFilterHit) + statistics.count(for: .blockCacheFilterAdd) }
+		let accessesBefore = filterAccesses()
+
+		let profilePath = self.path + ".prewarm"
+		defer { try? FileManager.default.removeItem(atPath: profilePath) }
+		let plist: [String: Any] = [
+			"version": 1,
+			"ranges": [["cf": "default", "start": "key 0000".data, "end": "key 0999".data, "reads": 1, "size": 0]]
+		]
+		try! PropertyListSerialization.data(fromPropertyList: plist, format: .binary, options: 0).write(to: URL(fileURLWithPath: profilePath))
+
+		let prewarmer = RocksDBCachePrewarmer(database: rocks, profile: try! RocksDBPrewarmProfile(contentsOfFile: profilePath))
+		prewarmer.start(completion: nil)
+		prewarmer.waitUntilFinished()
+
+		XCTAssertGreaterThan(filterAccesses(), accessesBefore)
+	}
+
+	func testSwift_Prewarm_InvalidProfile() {
+		let profilePath = self.path + ".prewarm"
+		defer { try? FileManager.default.removeItem(atPath: profilePath) }
+
+		let plists: [Any] = [
+			["version", 1],
+			["version": 1, "ranges": [["cf": "default", "start": "a".data, "reads": 1, "size": 0]]],
+			["version": 1, "ranges": [["cf": 1, "start": "a".data, "end": "b".data, "reads": 1, "size": 0]]],
+			["version": 1, "ranges": [["cf": "default", "start": "a", "end": "b".data, "reads": 1, "size": 0]]],
+			["version": 1, "ranges": ["default"]]
+		]
+
+		for plist in plists {
+			try! PropertyListSerialization.data(fromPropertyList: plist, format: .binary, options: 0).write(to: URL(fileURLWithPath: profilePath))
+			XCTAssertThrowsError(try RocksDBPrewarmProfile(contentsOfFile: profilePath))
+		}
+	}
+}
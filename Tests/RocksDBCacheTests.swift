@@ -0,0 +1,106 @@
+//
+//  RocksDBCacheTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBCacheTests : RocksDBTests {
+
+	func testSwift_Cache_Capacity() {
+		let lru = RocksDBCache.lruCache(withCapacity: 1 << 20)
+		XCTAssertEqual(lru.capacity, 1 << 20)
+
+		lru.capacity = 2 << 20
+		XCTAssertEqual(lru.capacity, 2 << 20)
+
+		let hyperClock = RocksDBCache.hyperClockCache(withCapacity: 1 << 20)
+		XCTAssertEqual(hyperClock.capacity, 1 << 20)
+		XCTAssertFalse(hyperClock.strictCapacityLimit)
+
+		hyperClock.capacity = 4 << 20
+		XCTAssertEqual(hyperClock.capacity, 4 << 20)
+	}
+
+	func testSwift_Cache_Usage() {
+		let cache = RocksDBCache.hyperClockCache(withCapacity: 8 << 20)
+		XCTAssertEqual(cache.usage, 0)
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+			options.blockCache = cache
+		})
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<1000 {
+			try! rocks.setData("value \(i)".data, forKey: String(format: "key %04d", i).data)
+		}
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		for i in 0..<1000 {
+			_ = try? rocks.data(forKey: String(format: "key %04d", i).data)
+		}
+
+		XCTAssertGreaterThan(cache.usage, 0)
+		XCTAssertLessThanOrEqual(cache.pinnedUsage, cache.usage)
+	}
+
+	func testSwift_Cache_CompressedSecondaryCache() {
+		let cache = RocksDBCache.lruCache(withCapacity: 64 << 10, compressedSecondaryCapacity: 4 << 20)
+		XCTAssertEqual(cache.capacity, 64 << 10)
+		XCTAssertEqual(cache.secondaryCapacity, 4 << 20)
+
+		let hyperClock = RocksDBCache.hyperClockCache(withCapacity: 64 << 10, compressedSecondaryCapacity: 4 << 20, compressionType: .none)
+		XCTAssertEqual(hyperClock.secondaryCapacity, 4 << 20)
+		XCTAssertEqual(RocksDBCache.lruCache(withCapacity: 64 << 10).secondaryCapacity, 0)
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+			options.blockCache = cache
+		})
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let value = Data(repeating: 0x61, count: 1024)
+		for i in 0..<1000 {
+			try! rocks.setData(value, forKey: String(format: "key %04d", i).data)
+		}
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		// Evicted blocks are admitted into the secondary tier on their second eviction
+		for _ in 0..<3 {
+			for i in 0..<1000 {
+				XCTAssertEqual(try! rocks.data(forKey: String(format: "key %04d", i).data), value)
+			}
+		}
+
+		XCTAssertGreaterThan(cache.secondaryUsage, 0)
+	}
+
+	func testSwift_Cache_RowCache() {
+		let statistics = RocksDBStatistics()
+		let rowCache = RocksDBCache.lruCache(withCapacity: 1 << 20)
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.statistics = statistics
+		options.rowCache = rowCache
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.setData("value 2", forKey: "key 2")
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		XCTAssertEqual(try! rocks.data(forKey: "key 1"), "value 1".data)
+		XCTAssertEqual(statistics.count(for: RocksDBTicker.rowCacheMiss), UInt64(1))
+
+		XCTAssertEqual(try! rocks.data(forKey: "key 1"), "value 1".data)
+		XCTAssertEqual(statistics.count(for: RocksDBTicker.rowCacheHit), UInt64(1))
+		XCTAssertGreaterThan(rowCache.usage, 0)
+	}
+}
@@ -0,0 +1,62 @@
+//
+//  RocksDBCompressionTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBCompressionTests : RocksDBTests {
+
+	func testSwift_Compression_PerLevel() {
+		let options = RocksDBOptions()
+		XCTAssertEqual(options.compressionPerLevel, [])
+		XCTAssertEqual(options.bottommostCompressionType, .disableOption)
+
+		options.compressionPerLevel = [
+			NSNumber(value: RocksDBCompressionType.none.rawValue),
+			NSNumber(value: RocksDBCompressionType.LZ4.rawValue),
+			NSNumber(value: RocksDBCompressionType.ZSTD.rawValue)
+		]
+		options.bottommostCompressionType = .ZSTD
+
+		XCTAssertEqual(options.compressionPerLevel.map { $0.int8Value }, [
+			RocksDBCompressionType.none.rawValue,
+			RocksDBCompressionType.LZ4.rawValue,
+			RocksDBCompressionType.ZSTD.rawValue
+		])
+		XCTAssertEqual(options.bottommostCompressionType, .ZSTD)
+	}
+
+	func testSwift_Compression_Options() {
+		let options = RocksDBOptions()
+		XCTAssertEqual(options.compressionOptions.maxDictBytes, 0)
+		XCTAssertEqual(options.compressionOptions.parallelThreads, 1)
+		XCTAssertFalse(options.bottommostCompressionOptions.enabled)
+
+		options.bottommostCompressionOptions.enabled = true
+		options.bottommostCompressionOptions.maxDictBytes = 16 << 10
+		options.bottommostCompressionOptions.zstdMaxTrainBytes = 100 * (16 << 10)
+		options.compressionOptions.parallelThreads = 4
+
+		XCTAssertTrue(options.bottommostCompressionOptions.enabled)
+		XCTAssertEqual(options.bottommostCompressionOptions.maxDictBytes, 16 << 10)
+		XCTAssertEqual(options.bottommostCompressionOptions.zstdMaxTrainBytes, 100 * (16 << 10))
+		XCTAssertEqual(options.compressionOptions.parallelThreads, 4)
+		XCTAssertEqual(options.compressionOptions.maxDictBytes, 0)
+	}
+
+	func testSwift_Compression_Open() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.compressionPerLevel = [NSNumber(value: RocksDBCompressionType.none.rawValue)]
+		options.compressionOptions.parallelThreads = 2
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		XCTAssertEqual(try! rocks.data(forKey: "key 1"), "value 1")
+	}
+}
@@ -0,0 +1,78 @@
+//
+//  RocksDBInMemoryServingTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBInMemoryServingTests : RocksDBTests {
+
+	let numKeys = 10000
+
+	// The first 5 digits are the fixed-length prefix, which partitions the keys into
+	// buckets of 10 for the PlainTable hash index and the hash mem table
+	let prefixLength = 5
+
+	func key(_ i: Int) -> Data {
+		return String(format: "%06d", i).data
+	}
+
+	func openAndFill(_ options: RocksDBOptions) {
+		options.createIfMissing = true
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<numKeys {
+			try! rocks.setData("value \(i)".data, forKey: key(i))
+		}
+		try! rocks.compactRange(RocksDBOpenRange, with: RocksDBCompactRangeOptions())
+	}
+
+	func measurePointLookups() {
+		measure {
+			for i in 0..<numKeys {
+				_ = try! rocks.data(forKey: key((i * 7919) % numKeys))
+			}
+		}
+	}
+
+	func testSwift_InMemoryServing_PlainTable() {
+		let options = RocksDBOptions()
+		options.optimizeForInMemoryServing(with: .plain, prefixLength: prefixLength)
+		XCTAssertTrue(options.allowMmapReads)
+		XCTAssertFalse(options.allowMmapWrites)
+
+		openAndFill(options)
+
+		XCTAssertEqual(try! rocks.data(forKey: key(42)), "value 42".data)
+		XCTAssertNil(try? rocks.data(forKey: "999999".data))
+	}
+
+	func testSwift_InMemoryServing_CuckooTable() {
+		let options = RocksDBOptions()
+		options.optimizeForInMemoryServing(with: .cuckoo, prefixLength: 0)
+
+		openAndFill(options)
+
+		XCTAssertEqual(try! rocks.data(forKey: key(42)), "value 42".data)
+	}
+
+	func testSwift_InMemoryServing_PointLookupPerformance_BlockBased() {
+		openAndFill(RocksDBOptions())
+		measurePointLookups()
+	}
+
+	func testSwift_InMemoryServing_PointLookupPerformance_PlainTable() {
+		let options = RocksDBOptions()
+		options.optimizeForInMemoryServing(with: .plain, prefixLength: prefixLength)
+		openAndFill(options)
+		measurePointLookups()
+	}
+
+	func testSwift_InMemoryServing_PointLookupPerformance_CuckooTable() {
+		let options = RocksDBOptions()
+		options.optimizeForInMemoryServing(with: .cuckoo, prefixLength: 0)
+		openAndFill(options)
+		measurePointLookups()
+	}
+}
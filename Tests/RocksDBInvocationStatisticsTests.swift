@@ -0,0 +1,104 @@
+//
+//  RocksDBInvocationStatisticsTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBInvocationStatisticsTests : RocksDBTests {
+
+	func testSwift_InvocationStatistics_Comparator() {
+		let statistics = RocksDBInvocationStatistics()
+		let comparator = RocksDBComparator(type: .stringCompareAscending)
+		comparator.callbackStatistics = statistics
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.comparator = comparator
+		options.trackCallbackContext = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<100 {
+			try! rocks.setData("value", forKey: "key \(i)")
+		}
+
+		XCTAssertGreaterThan(statistics.invocationCount(in: .foreground), 0)
+		XCTAssertEqual(statistics.invocationCount(in: .background), 0)
+
+		let histogram = statistics.histogram(in: .foreground)
+		XCTAssertEqual(histogram.count, statistics.invocationCount(in: .foreground))
+		XCTAssertEqual(histogram.sum, statistics.totalNanos(in: .foreground))
+
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		XCTAssertGreaterThan(statistics.invocationCount(in: .background), 0)
+
+		// The compaction has completed, so callbacks are foreground again on every thread
+		let backgroundCount = statistics.invocationCount(in: .background)
+		_ = try? rocks.data(forKey: "key 1")
+		XCTAssertEqual(statistics.invocationCount(in: .background), backgroundCount)
+
+		statistics.reset()
+
+		XCTAssertEqual(statistics.invocationCount(in: .foreground), 0)
+		XCTAssertEqual(statistics.invocationCount(in: .background), 0)
+	}
+
+	func testSwift_InvocationStatistics_ContextNotTracked() {
+		let statistics = RocksDBInvocationStatistics()
+		let comparator = RocksDBComparator(type: .stringCompareAscending)
+		comparator.callbackStatistics = statistics
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.comparator = comparator
+
+		XCTAssertFalse(options.trackCallbackContext)
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<100 {
+			try! rocks.setData("value", forKey: "key \(i)")
+		}
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		XCTAssertGreaterThan(statistics.invocationCount(in: .foreground), 0)
+		XCTAssertEqual(statistics.invocationCount(in: .background), 0)
+	}
+
+	func testSwift_InvocationStatistics_MergeOperator() {
+		let statistics = RocksDBInvocationStatistics()
+		let mergeOp = RocksDBMergeOperator(name: "operator") { (key, existing, value) -> Data in
+			var result = value
+			if let existing = existing {
+				result = existing + value
+			}
+			return result
+		}
+		mergeOp.callbackStatistics = statistics
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.mergeOperator = mergeOp
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.merge("a".data, forKey: "key")
+		try! rocks.merge("b".data, forKey: "key")
+
+		XCTAssertEqual(statistics.invocationCount(in: .foreground), 0)
+
+		XCTAssertEqual(try! rocks.data(forKey: "key"), "ab".data)
+		XCTAssertGreaterThan(statistics.invocationCount(in: .foreground), 0)
+	}
+
+	func testSwift_InvocationStatistics_Disabled() {
+		let comparator = RocksDBComparator(type: .stringCompareAscending)
+		XCTAssertNil(comparator.callbackStatistics)
+
+		let prefixExtractor = RocksDBPrefixExtractor(type: .fixedLength, length: 3)
+		XCTAssertNil(prefixExtractor.callbackStatistics)
+	}
+}
@@ -0,0 +1,67 @@
+//
+//  RocksDBMemoryUsageTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBMemoryUsageTests : RocksDBTests {
+
+	func testSwift_MemoryUsage() {
+		let cache = RocksDBCache.lruCache(withCapacity: 1 << 20)
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+			options.blockCache = cache
+		})
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.setData("value 2", forKey: "key 2")
+
+		let usage = try! RocksDBMemoryUsage(databases: [rocks], caches: [cache, cache])
+		XCTAssertGreaterThan(usage.memTableTotal, 0)
+		XCTAssertGreaterThan(usage.memTableUnflushed, 0)
+		XCTAssertEqual(usage.cacheTotal, UInt64(cache.usage))
+
+		XCTAssertEqual(usage.databases.count, 1)
+		XCTAssertEqual(usage.databases[0].columnFamilies.count, 1)
+		XCTAssertEqual(usage.databases[0].columnFamilies[0].name, "default")
+		XCTAssertEqual(usage.databases[0].memTableUnflushed, usage.memTableUnflushed)
+	}
+
+	func testSwift_MemoryUsage_ColumnFamilies() {
+		let descriptor = RocksDBColumnFamilyDescriptor()
+		descriptor.addDefaultColumnFamily(with: RocksDBColumnFamilyOptions())
+		descriptor.addColumnFamily(withName: "new_cf", andOptions: RocksDBColumnFamilyOptions())
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.createMissingColumnFamilies = true
+
+		rocks = try! RocksDB.database(atPath: self.path, columnFamilies: descriptor, andOptions: options)
+
+		let newColumnFamily = rocks.columnFamilies()[1]
+		try! rocks.setData("value", forKey: "key", forColumnFamily: newColumnFamily)
+
+		let usage = try! RocksDBMemoryUsage(databases: [rocks], caches: nil)
+		let columnFamilies = usage.databases[0].columnFamilies
+		XCTAssertEqual(columnFamilies.count, 2)
+		XCTAssertEqual(columnFamilies[1].name, "new_cf")
+		XCTAssertGreaterThan(columnFamilies[1].memTableUnflushed, 0)
+		XCTAssertEqual(usage.databases[0].memTableTotal, columnFamilies[0].memTableTotal + columnFamilies[1].memTableTotal)
+	}
+
+	func testSwift_MemoryUsage_ClosedDatabase() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+		rocks.close()
+
+		XCTAssertThrowsError(try RocksDBMemoryUsage(databases: [rocks], caches: nil))
+	}
+}
@@ -0,0 +1,74 @@
+//
+//  RocksDBMetricsExporterTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBMetricsExporterTests : RocksDBTests {
+
+	func testSwift_MetricsExporter_OpenMetrics() {
+		let statistics = RocksDBStatistics()
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.statistics = statistics
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.data(forKey: "key 1")
+
+		let exporter = RocksDBMetricsExporter(statistics: statistics)
+		exporter.labels = ["instance": "test \"1\""]
+		exporter.addDatabase(rocks, withName: "main")
+
+		let text = String(data: exporter.exportMetrics(), encoding: .utf8)!
+		let lines = text.components(separatedBy: "\n")
+
+		XCTAssertTrue(lines.contains("# TYPE rocksdb_bytes_written counter"))
+		XCTAssertTrue(lines.contains { $0.hasPrefix("rocksdb_bytes_written_total{instance=\"test \\\"1\\\"\"} ") })
+		XCTAssertTrue(lines.contains("# TYPE rocksdb_db_get_micros summary"))
+		XCTAssertTrue(lines.contains { $0.hasPrefix("rocksdb_db_get_micros{instance=\"test \\\"1\\\"\",quantile=\"0.99\"} ") })
+		XCTAssertTrue(lines.contains("rocksdb_db_get_micros_count{instance=\"test \\\"1\\\"\"} 1"))
+		XCTAssertTrue(lines.contains("# TYPE rocksdb_cur_size_all_mem_tables gauge"))
+		XCTAssertTrue(lines.contains { $0.hasPrefix("rocksdb_cur_size_all_mem_tables{instance=\"test \\\"1\\\"\",db=\"main\",cf=\"default\"} ") })
+		XCTAssertEqual(lines[lines.count - 2], "# EOF")
+	}
+
+	func testSwift_MetricsExporter_Prometheus() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let exporter = RocksDBMetricsExporter(statistics: nil)
+		exporter.format = .prometheus
+		exporter.intProperties = ["rocksdb.num-running-compactions"]
+		exporter.addDatabase(rocks, withName: "main")
+
+		var text = String(data: exporter.exportMetrics(), encoding: .utf8)!
+		XCTAssertEqual(text, "# TYPE rocksdb_num_running_compactions gauge\nrocksdb_num_running_compactions{db=\"main\",cf=\"default\"} 0\n")
+
+		rocks.close()
+
+		text = String(data: exporter.exportMetrics(), encoding: .utf8)!
+		XCTAssertEqual(text, "")
+	}
+
+	func testSwift_MetricsExporter_FileDescriptor() {
+		let statistics = RocksDBStatistics()
+		let exporter = RocksDBMetricsExporter(statistics: statistics)
+
+		let file = self.path + ".metrics"
+		FileManager.default.createFile(atPath: file, contents: nil)
+		defer { try? FileManager.default.removeItem(atPath: file) }
+
+		let handle = FileHandle(forWritingAtPath: file)!
+		try! exporter.write(toFileDescriptor: handle.fileDescriptor)
+		handle.closeFile()
+
+		XCTAssertEqual(FileManager.default.contents(atPath: file), exporter.exportMetrics())
+	}
+}
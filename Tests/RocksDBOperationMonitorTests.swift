@@ -0,0 +1,77 @@
+//
+//  RocksDBOperationMonitorTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBOperationMonitorTests : RocksDBTests {
+
+	func testSwift_OperationMonitor_RingBuffer() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.enableThreadTracking = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let monitor = RocksDBOperationMonitor(env: RocksDBEnv(), capacity: 3)
+		XCTAssertNil(monitor.latestSample)
+
+		var taken = [RocksDBOperationSample]()
+		for _ in 0..<5 {
+			taken.append(monitor.sample())
+		}
+
+		XCTAssertEqual(monitor.samples.count, 3)
+		XCTAssertTrue(monitor.samples[0] === taken[2])
+		XCTAssertTrue(monitor.samples[2] === taken[4])
+		XCTAssertTrue(monitor.latestSample === taken[4])
+	}
+
+	func testSwift_OperationMonitor_Periodic() {
+		// A slow merge operator keeps the compaction running long enough to be sampled
+		let mergeOperator = RocksDBMergeOperator(name: "slow") { (key, existing, value) -> Data in
+			Thread.sleep(forTimeInterval: 0.001)
+			return (existing ?? Data()) + value
+		}
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.enableThreadTracking = true
+		options.mergeOperator = mergeOperator
+		options.disableAutoCompactions = true
+		options.writeBufferSize = 16 << 10
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<500 {
+			try! rocks.merge("a".data, forKey: "key \(i)".data)
+			try! rocks.merge("b".data, forKey: "key \(i)".data)
+		}
+
+		let monitor = RocksDBOperationMonitor(env: RocksDBEnv(), capacity: 1000)
+		monitor.startSampling(interval: 0.01)
+
+		let compactRangeOptions = RocksDBCompactRangeOptions()
+		compactRangeOptions.bottommostLevelCompaction = .force
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: compactRangeOptions)
+
+		monitor.stopSampling()
+
+		let compactions = monitor.samples.flatMap { sample in
+			sample.operations.filter { $0.operationType == .compaction }.map { (sample, $0) }
+		}
+		XCTAssertGreaterThan(compactions.count, 0)
+
+		for (sample, operation) in compactions {
+			XCTAssertTrue(sample.busiestOperation != nil)
+			XCTAssertGreaterThanOrEqual(sample.bytesPerSecond(for: sample.busiestOperation!), sample.bytesPerSecond(for: operation))
+			XCTAssertNotEqual(operation.operationStage, .unknown)
+			XCTAssertNotNil(operation.operationProperties["JobID"])
+			XCTAssertTrue(operation.isManualCompaction)
+			XCTAssertGreaterThanOrEqual(operation.progress, 0)
+			XCTAssertLessThanOrEqual(operation.progress, 1)
+		}
+	}
+}
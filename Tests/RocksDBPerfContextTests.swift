@@ -0,0 +1,68 @@
+//
+//  RocksDBPerfContextTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBPerfContextTests : RocksDBTests {
+
+	func testSwift_PerfContext_Measure() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<100 {
+			try! rocks.setData("value \(i)".data, forKey: "key \(i)".data)
+		}
+		for i in 0..<50 {
+			try! rocks.deleteData(forKey: "key \(i)".data)
+		}
+
+		let get = RocksDBPerfContext.measure(level: .enableTime) {
+			_ = try! self.rocks.data(forKey: "key 60".data)
+		}
+		XCTAssertGreaterThan(get.getFromMemtableCount, 0)
+		XCTAssertEqual(get.getReadBytes, UInt64("value 60".count))
+		XCTAssertFalse(get.description.isEmpty)
+
+		let seek = RocksDBPerfContext.measure(level: .enableCount) {
+			let iterator = self.rocks.iterator()
+			iterator.seekToFirst()
+			iterator.close()
+		}
+		XCTAssertGreaterThan(seek.seekOnMemtableCount, 0)
+		XCTAssertGreaterThanOrEqual(seek.internalDeleteSkippedCount, 1)
+		XCTAssertEqual(seek.seekInternalSeekTime, 0)
+	}
+
+	func testSwift_PerfContext_Sampler() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value", forKey: "key")
+
+		var contexts = [RocksDBPerfContext]()
+		let sampler = RocksDBPerfContextSampler(sampleRate: 1.0, level: .enableCount) { context in
+			contexts.append(context)
+		}
+
+		XCTAssertTrue(sampler.measure {
+			_ = try! self.rocks.data(forKey: "key")
+		})
+		XCTAssertEqual(contexts.count, 1)
+		XCTAssertGreaterThan(contexts[0].getReadBytes, 0)
+
+		sampler.sampleRate = 0
+		for _ in 0..<100 {
+			XCTAssertFalse(sampler.measure {
+				_ = try! self.rocks.data(forKey: "key")
+			})
+		}
+		XCTAssertEqual(contexts.count, 1)
+	}
+}
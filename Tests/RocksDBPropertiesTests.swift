@@ -47,4 +47,67 @@ class RocksDBPropertiesTests : RocksDBTests {
 		XCTAssertNotNil(rocks.value(forProperty: "rocksdb.stats", inColumnFamily: columnFamilies[1]));
 		XCTAssertNotNil(rocks.value(forProperty: "rocksdb.sstables", inColumnFamily: columnFamilies[1]));
 	}
+
+	func testSwift_Properties_MapProperty_ColumnFamily() {
+		let descriptor = RocksDBColumnFamilyDescriptor()
+		descriptor.addDefaultColumnFamily(with: RocksDBColumnFamilyOptions())
+		descriptor.addColumnFamily(withName: "new_cf", andOptions: RocksDBColumnFamilyOptions())
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.createMissingColumnFamilies = true
+
+		rocks = try! RocksDB.database(atPath: path, columnFamilies: descriptor, andOptions: options)
+
+		let columnFamilies = rocks.columnFamilies()
+
+		try! rocks.setData("value", forKey: "key 1", forColumnFamily: columnFamilies[1])
+		try! rocks.setData("value", forKey: "key 2", forColumnFamily: columnFamilies[1])
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions(), inColumnFamily: columnFamilies[1])
+
+		let property = RocksDBMapPropertyName.aggregatedTableProperties.rawValue
+		let defaultProperties = rocks.value(forMapProperty: property, inColumnFamily: columnFamilies[0])
+		let newProperties = rocks.value(forMapProperty: property, inColumnFamily: columnFamilies[1])
+
+		XCTAssertEqual(newProperties["num_entries"], "2")
+		XCTAssertNotEqual(defaultProperties["num_entries"], "2")
+	}
+
+	func testSwift_Properties_IntPropertyTable() {
+		let descriptor = RocksDBColumnFamilyDescriptor()
+		descriptor.addDefaultColumnFamily(with: RocksDBColumnFamilyOptions())
+		descriptor.addColumnFamily(withName: "new_cf", andOptions: RocksDBColumnFamilyOptions())
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.createMissingColumnFamilies = true
+
+		rocks = try! RocksDB.database(atPath: path, columnFamilies: descriptor, andOptions: options)
+
+		let columnFamilies = rocks.columnFamilies()
+
+		try! rocks.setData("value", forKey: "key 1", forColumnFamily: columnFamilies[0])
+		try! rocks.setData("value", forKey: "key 2", forColumnFamily: columnFamilies[1])
+		try! rocks.setData("value", forKey: "key 3", forColumnFamily: columnFamilies[1])
+
+		let properties: [RocksDBIntPropertyName] = [.numEntriesActiveMemTable, .curSizeActiveMemTable, RocksDBIntPropertyName("rocksdb.no-such-property")]
+		let table = rocks.values(forIntProperties: properties, inColumnFamilies: columnFamilies, aggregated: true)
+
+		XCTAssertEqual(table.value(atRow: 0, column: 0), 1)
+		XCTAssertEqual(table.value(atRow: 0, column: 1), 2)
+		XCTAssertEqual(table.value(forProperty: .numEntriesActiveMemTable, inColumnFamily: columnFamilies[1]), 2)
+		XCTAssertEqual(table.aggregatedValue(atRow: 0), 3)
+
+		let property = RocksDBIntPropertyName.curSizeActiveMemTable.rawValue
+		XCTAssertEqual(table.value(atRow: 1, column: 1), rocks.value(forIntProperty: property, inColumnFamily: columnFamilies[1]))
+		XCTAssertEqual(table.aggregatedValue(atRow: 1), rocks.aggregatedValue(forIntProperty: property))
+
+		XCTAssertTrue(table.hasValue(atRow: 0, column: 0))
+		XCTAssertFalse(table.hasValue(atRow: 2, column: 0))
+		XCTAssertEqual(table.value(atRow: 2, column: 0), 0)
+
+		let plainTable = rocks.values(forIntProperties: properties, inColumnFamilies: columnFamilies)
+		XCTAssertEqual(plainTable.value(atRow: 0, column: 1), 2)
+		XCTAssertEqual(plainTable.aggregatedValue(atRow: 0), 0)
+	}
 }
@@ -65,4 +65,105 @@ class RocksDBStatisticsTests : RocksDBTests {
 		XCTAssertNotNil(dbGetHistogram);
 		XCTAssertGreaterThan(dbGetHistogram.median, 0.0);
 	}
+
+	func testSwift_Statistics_StatsLevel() {
+		let statistics = RocksDBStatistics()
+
+		statistics.statsLevel = .exceptTimers
+		XCTAssertEqual(statistics.statsLevel, .exceptTimers)
+
+		statistics.statsLevel = .exceptHistogramOrTimers
+		XCTAssertEqual(statistics.statsLevel, .exceptHistogramOrTimers)
+
+		statistics.statsLevel = .all
+		XCTAssertEqual(statistics.statsLevel, .all)
+	}
+
+	func testSwift_Statistics_Snapshot() {
+		let statistics = RocksDBStatistics()
+
+		let options = RocksDBOptions();
+		options.createIfMissing = true
+		options.statistics = statistics;
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value 1", forKey: "key 1")
+
+		let first = statistics.snapshot()
+		XCTAssertEqual(first.count(for: .bytesWritten), statistics.count(for: .bytesWritten))
+
+		var names = [String]()
+		first.enumerateTickers { (ticker, name, count) in
+			names.append(name)
+		}
+		XCTAssertTrue(names.contains("rocksdb.bytes.written"))
+
+		for i in 0..<100 {
+			try! rocks.setData("value \(i)".data, forKey: "key \(i)".data)
+		}
+		for i in 0..<50 {
+			try! rocks.data(forKey: "key \(i)".data)
+		}
+
+		let second = statistics.snapshot()
+		XCTAssertGreaterThanOrEqual(second.timestamp, first.timestamp)
+
+		let delta = second.delta(since: first)
+		XCTAssertEqual(delta.count(for: .bytesWritten), second.count(for: .bytesWritten) - first.count(for: .bytesWritten))
+		XCTAssertEqual(delta.count(for: RocksDBHistogram.dbGet), 50)
+		XCTAssertEqual(second.histogramData(forType: .dbGet).count - first.histogramData(forType: .dbGet).count, 50)
+		XCTAssertGreaterThan(delta.average(for: RocksDBHistogram.dbGet), 0)
+
+		let reverse = first.delta(since: second)
+		XCTAssertEqual(reverse.count(for: .bytesWritten), 0)
+	}
+
+	func testSwift_Statistics_HistogramPercentiles() {
+		let statistics = RocksDBStatistics()
+
+		let options = RocksDBOptions();
+		options.createIfMissing = true
+		options.statistics = statistics;
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for i in 0..<1000 {
+			try! rocks.setData("value \(i)".data, forKey: "key \(i)".data)
+		}
+
+		let histogram = statistics.histogramData(forType: .dbWrite)
+		XCTAssertGreaterThanOrEqual(histogram.percentile99, histogram.percentile95)
+		XCTAssertGreaterThanOrEqual(histogram.percentile95, histogram.median)
+	}
+
+	func testSwift_Statistics_History() {
+		let statistics = RocksDBStatistics()
+
+		let options = RocksDBOptions();
+		options.createIfMissing = true
+		options.statistics = statistics;
+		options.statsPersistPeriodSec = 1
+		options.statsHistoryBufferSize = 1 << 20
+
+		XCTAssertEqual(options.statsPersistPeriodSec, 1)
+		XCTAssertEqual(options.statsHistoryBufferSize, 1 << 20)
+		XCTAssertFalse(options.persistStatsToDisk)
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let start = Date()
+		for i in 0..<100 {
+			try! rocks.setData("value \(i)".data, forKey: "key \(i)".data)
+		}
+		Thread.sleep(forTimeInterval: 2.5)
+
+		let history = try! rocks.statsHistory(from: start.addingTimeInterval(-1), to: Date.distantFuture)
+		XCTAssertGreaterThan(history.count, 0)
+
+		let written = history.reduce(0) { $0 + $1.count(for: .bytesWritten) }
+		XCTAssertGreaterThan(written, 0)
+		XCTAssertEqual(history[0].interval, 1)
+		XCTAssertNotNil(history[0].tickers["rocksdb.bytes.written"])
+	}
 }
@@ -0,0 +1,63 @@
+//
+//  RocksDBTablePropertiesTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBTablePropertiesTests : RocksDBTests {
+
+	func testSwift_TableProperties_PrefixCount() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.tablePropertiesCollectorFactories = [
+			RocksDBTablePropertiesCollectorFactory.prefixCountCollectorFactory(withPrefixLength: 2)
+		]
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value", forKey: "a:1")
+		try! rocks.setData("value", forKey: "a:2")
+		try! rocks.setData("value", forKey: "b:1")
+
+		try! rocks.compactRange(RocksDBMakeKeyRange("a", "c"), with: RocksDBCompactRangeOptions())
+
+		let properties = try! rocks.propertiesOfAllTables()
+		XCTAssertEqual(properties.count, 1)
+
+		let table = properties.values.first!
+		XCTAssertEqual(table.numEntries, 3)
+		XCTAssertEqual(table.count(forPrefix: "a:"), 2)
+		XCTAssertEqual(table.count(forPrefix: "b:"), 1)
+		XCTAssertEqual(table.count(forPrefix: "c:"), 0)
+	}
+
+	func testSwift_TableProperties_BlockCollector() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.tablePropertiesCollectorFactories = [
+			RocksDBTablePropertiesCollectorFactory(name: "max.value", addBlock: { (key, value, properties) in
+				let current = properties["max"] as? Data
+				if current == nil || current!.lexicographicallyPrecedes(value) {
+					properties["max"] = value
+				}
+			})
+		]
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("1", forKey: "key 1")
+		try! rocks.setData("3", forKey: "key 2")
+		try! rocks.setData("2", forKey: "key 3")
+
+		try! rocks.compactRange(RocksDBMakeKeyRange("key", "kez"), with: RocksDBCompactRangeOptions())
+
+		let inRange = try! rocks.propertiesOfTables(inRanges: [RocksDBMakeKeyRange("key 1", "key 4")])
+		XCTAssertEqual(inRange.count, 1)
+		XCTAssertEqual(inRange.values.first!.userCollectedProperties["max"], "3".data)
+
+		let outOfRange = try! rocks.propertiesOfTables(inRanges: [RocksDBMakeKeyRange("x", "z")])
+		XCTAssertEqual(outOfRange.count, 0)
+	}
+}
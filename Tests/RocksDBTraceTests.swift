@@ -0,0 +1,77 @@
+//
+//  RocksDBTraceTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBTraceTests : RocksDBTests {
+
+	func testSwift_Trace_CaptureAndReplay() {
+		let tracePath = self.path + ".trace"
+		let replayPath = self.path + ".replay"
+		defer {
+			try? FileManager.default.removeItem(atPath: tracePath)
+			try? FileManager.default.removeItem(atPath: replayPath)
+		}
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let traceOptions = RocksDBTraceOptions()
+		XCTAssertEqual(traceOptions.samplingFrequency, 1)
+		XCTAssertEqual(traceOptions.filter, [])
+
+		try! rocks.startTrace(with: traceOptions, toPath: tracePath)
+		for i in 0..<100 {
+			try! rocks.setData("value \(i)".data, forKey: "key \(i)".data)
+		}
+		for i in 0..<10 {
+			_ = try? rocks.data(forKey: "key \(i)".data)
+		}
+		try! rocks.endTrace()
+
+		XCTAssertTrue(FileManager.default.fileExists(atPath: tracePath))
+
+		let replayRocks = try! RocksDB.database(atPath: replayPath, andOptions: options)
+		defer { replayRocks.close() }
+
+		let replayer = try! RocksDBTraceReplayer(traceAtPath: tracePath, database: replayRocks)
+		try! replayer.replay(withThreads: 4, speed: RocksDBTraceReplaySpeedUnlimited)
+
+		XCTAssertEqual(replayer.replayedOperations, 110)
+		XCTAssertEqual(try! replayRocks.data(forKey: "key 42"), "value 42".data)
+	}
+
+	func testSwift_Trace_Filter() {
+		let tracePath = self.path + ".trace"
+		defer { try? FileManager.default.removeItem(atPath: tracePath) }
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let traceOptions = RocksDBTraceOptions()
+		traceOptions.filter = [.outGets, .outIteratorSeeks]
+		XCTAssertEqual(traceOptions.filter, [.outGets, .outIteratorSeeks])
+
+		try! rocks.startTrace(with: traceOptions, toPath: tracePath)
+		try! rocks.setData("value", forKey: "key")
+		_ = try? rocks.data(forKey: "key")
+		try! rocks.endTrace()
+
+		let replayRocks = try! RocksDB.database(atPath: self.path + ".replay", andOptions: options)
+		defer {
+			replayRocks.close()
+			try? FileManager.default.removeItem(atPath: self.path + ".replay")
+		}
+
+		let replayer = try! RocksDBTraceReplayer(traceAtPath: tracePath, database: replayRocks)
+		try! replayer.replay(withThreads: 1, speed: 1)
+		XCTAssertEqual(replayer.replayedOperations, 1)
+	}
+}
@@ -0,0 +1,104 @@
+//
+//  RocksDBTupleKeyTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBTupleKeyTests : RocksDBTests {
+
+	func testSwift_TupleKey_RoundTrip() {
+		let tuple: [Any] = [NSNull(), "us\0east", Data([0x00, 0xFF, 0x00]), -42, 3.5]
+		let key = try! RocksDBTupleEncoder.encodeTuple(tuple)
+		let decoded = try! RocksDBTupleDecoder.decodeTuple(key)
+
+		XCTAssertEqual(decoded.count, 5)
+		XCTAssertTrue(decoded[0] is NSNull)
+		XCTAssertEqual(decoded[1] as? String, "us\0east")
+		XCTAssertEqual(decoded[2] as? Data, Data([0x00, 0xFF, 0x00]))
+		XCTAssertEqual((decoded[3] as! NSNumber).int64Value, -42)
+		XCTAssertEqual((decoded[4] as! NSNumber).doubleValue, 3.5)
+
+		let decoder = RocksDBTupleDecoder(data: key)
+		XCTAssertEqual(decoder.nextFieldType, .null)
+		XCTAssertThrowsError(try decoder.decodeString())
+		try! decoder.decodeNull()
+		XCTAssertEqual(try! decoder.decodeString(), "us\0east")
+		XCTAssertEqual(try! decoder.decodeData(), Data([0x00, 0xFF, 0x00]))
+		XCTAssertEqual(try! decoder.decodeInt64().int64Value, -42)
+		XCTAssertEqual(try! decoder.decodeDouble().doubleValue, 3.5)
+		XCTAssertTrue(decoder.atEnd)
+		XCTAssertEqual(decoder.nextFieldType, .invalid)
+
+		XCTAssertThrowsError(try RocksDBTupleEncoder.encodeTuple([Date()]))
+		XCTAssertThrowsError(try RocksDBTupleDecoder.decodeTuple("\u{30}abc".data))
+		XCTAssertThrowsError(try RocksDBTupleDecoder(data: Data([0x20, 0xC3, 0x28, 0x00])).decodeString())
+	}
+
+	func testSwift_TupleKey_Order() {
+		let encoder = RocksDBTupleEncoder(capacity: 64)
+
+		func encode(_ values: [Int64]) -> [Data] {
+			return values.map { value in
+				encoder.reset()
+				encoder.encodeInt64(value)
+				return encoder.data
+			}
+		}
+
+		let ints: [Int64] = [Int64.min, -256, -1, 0, 1, 255, 256, Int64.max]
+		XCTAssertEqual(encode(ints), encode(ints).sorted { $0.lexicographicallyPrecedes($1) })
+
+		let doubles: [Double] = [-Double.infinity, -1e10, -0.5, -0.0, 0.0, 1e-10, 0.5, 1e10, Double.infinity]
+		let encodedDoubles: [Data] = doubles.map { value in
+			encoder.reset()
+			encoder.encodeDouble(value)
+			return encoder.data
+		}
+		XCTAssertEqual(encodedDoubles, encodedDoubles.sorted { $0.lexicographicallyPrecedes($1) })
+
+		let strings = ["", "\0", "a", "a\0", "a\0b", "ab", "b"]
+		let encodedStrings: [Data] = strings.map { value in
+			try! RocksDBTupleEncoder.encodeTuple([value, 1])
+		}
+		XCTAssertEqual(encodedStrings, encodedStrings.sorted { $0.lexicographicallyPrecedes($1) })
+
+		encoder.reset()
+		encoder.encodeString("key")
+		var buffer = [UInt8](repeating: 0, count: 16)
+		XCTAssertEqual(encoder.getBytes(&buffer, maxLength: 16), encoder.length)
+		XCTAssertEqual(Data(buffer[0..<Int(encoder.length)]), encoder.data)
+		XCTAssertEqual(encoder.getBytes(&buffer, maxLength: 2), 0)
+	}
+
+	func testSwift_TupleKey_PrefixExtractor() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.prefixExtractor = RocksDBPrefixExtractor(type: .tupleFields, length: 2)
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		for region in ["eu", "us"] {
+			for user: Int64 in [-1, 1] {
+				for time in [0.5, 1.5] {
+					let key = try! RocksDBTupleEncoder.encodeTuple([region, user, time])
+					try! rocks.setData("x".data, forKey: key)
+				}
+			}
+		}
+
+		let prefix = try! RocksDBTupleEncoder.encodeTuple(["us", -1])
+		var keys = [[Any]]()
+
+		rocks.iterator().enumerateKeys(withPrefix: prefix, using: { (key, stop) -> Void in
+			keys.append(try! RocksDBTupleDecoder.decodeTuple(key))
+		})
+
+		XCTAssertEqual(keys.count, 2)
+		XCTAssertEqual(keys[0][0] as? String, "us")
+		XCTAssertEqual((keys[0][1] as! NSNumber).int64Value, -1)
+		XCTAssertEqual((keys[0][2] as! NSNumber).doubleValue, 0.5)
+		XCTAssertEqual((keys[1][2] as! NSNumber).doubleValue, 1.5)
+	}
+}
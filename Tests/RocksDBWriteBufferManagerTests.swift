@@ -0,0 +1,51 @@
+//
+//  RocksDBWriteBufferManagerTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBWriteBufferManagerTests : RocksDBTests {
+
+	func testSwift_WriteBufferManager() {
+		let manager = RocksDBWriteBufferManager(bufferSize: 4 << 20)
+		XCTAssertTrue(manager.isEnabled)
+		XCTAssertFalse(manager.costToCache)
+		XCTAssertFalse(manager.allowStall)
+		XCTAssertEqual(manager.bufferSize, 4 << 20)
+
+		manager.bufferSize = 8 << 20
+		XCTAssertEqual(manager.bufferSize, 8 << 20)
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.writeBufferManager = manager
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.setData("value 2", forKey: "key 2")
+
+		XCTAssertGreaterThan(manager.memoryUsage, 0)
+		XCTAssertGreaterThan(manager.mutableMemtableMemoryUsage, 0)
+	}
+
+	func testSwift_WriteBufferManager_CostToCache() {
+		let cache = RocksDBCache.lruCache(withCapacity: 16 << 20)
+		let manager = RocksDBWriteBufferManager(bufferSize: 4 << 20, cache: cache, allowStall: true)
+		XCTAssertTrue(manager.costToCache)
+		XCTAssertTrue(manager.allowStall)
+		XCTAssertTrue(manager.cache === cache)
+
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+		options.writeBufferManager = manager
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value 1", forKey: "key 1")
+
+		XCTAssertGreaterThan(cache.usage, 0)
+	}
+}
@@ -0,0 +1,73 @@
+//
+//  RocksDBWriteStallTests.swift
+//  ObjectiveRocks
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBWriteStallTests : RocksDBTests {
+
+	func testSwift_WriteStall_State() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		try! rocks.setData("value", forKey: "key")
+
+		let state = rocks.writeStallState()
+		XCTAssertEqual(state.condition, .normal)
+		XCTAssertEqual(state.causes, [])
+		XCTAssertEqual(state.delayedWriteRate, 0)
+		XCTAssertLessThan(state.pressure, 1)
+	}
+
+	func testSwift_WriteStall_AdmissionControl_Shed() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let admissionControl = RocksDBWriteAdmissionControl()
+		// Any pressure is too much, so every low priority write is held back
+		admissionControl.pressureThreshold = 0
+		rocks.writeAdmissionControl = admissionControl
+
+		let lowPriority = RocksDBWriteOptions()
+		lowPriority.lowPriority = true
+
+		XCTAssertThrowsError(try rocks.setData("value 1", forKey: "key 1", writeOptions: lowPriority))
+		XCTAssertNoThrow(try rocks.setData("value 2", forKey: "key 2", writeOptions: RocksDBWriteOptions()))
+
+		XCTAssertNil(try? rocks.data(forKey: "key 1") as Any)
+		XCTAssertEqual(try! rocks.data(forKey: "key 2"), "value 2".data)
+		XCTAssertEqual(admissionControl.shedWriteCount, 1)
+	}
+
+	func testSwift_WriteStall_AdmissionControl_Defer() {
+		let options = RocksDBOptions()
+		options.createIfMissing = true
+
+		rocks = try! RocksDB.database(atPath: self.path, andOptions: options)
+
+		let admissionControl = RocksDBWriteAdmissionControl()
+		admissionControl.mode = .defer
+		admissionControl.maxDeferral = 0.05
+		admissionControl.refreshInterval = 0.01
+		rocks.writeAdmissionControl = admissionControl
+
+		let lowPriority = RocksDBWriteOptions()
+		lowPriority.lowPriority = true
+
+		XCTAssertNoThrow(try rocks.setData("value 1", forKey: "key 1", writeOptions: lowPriority))
+		XCTAssertEqual(admissionControl.shedWriteCount, 0)
+
+		admissionControl.pressureThreshold = 0
+
+		let start = Date()
+		XCTAssertThrowsError(try rocks.setData("value 2", forKey: "key 2", writeOptions: lowPriority))
+		XCTAssertGreaterThanOrEqual(Date().timeIntervalSince(start), 0.05)
+		XCTAssertEqual(admissionControl.shedWriteCount, 1)
+	}
+}